@@ -26,28 +26,25 @@ DEFINES += QT_DEPRECATED_WARNINGS
 
 CONFIG += c++11
 
+# protocol and scheduling are in the Core library
+include(../Core/core.pri)
+
 SOURCES += \
     main.cpp \
     mainwindow.cpp \
-    udptransfer.cpp \
-    registeraccess.cpp \
     meter.cpp \
-    updater.cpp \
-    iregisteraccess.cpp \
-    registermock.cpp \
-    fader.cpp
+    fader.cpp \
+    healthview.cpp \
+    meterbridge.cpp \
+    diagnosticsview.cpp
 
 HEADERS += \
     mainwindow.h \
-    udptransfer.h \
-    registeraccess.h \
-    typedefinitions.h \
     meter.h \
-    updater.h \
-    iupdateelement.h \
-    iregisteraccess.h \
-    registermock.h \
-    fader.h
+    fader.h \
+    healthview.h \
+    meterbridge.h \
+    diagnosticsview.h
 
 FORMS += \
     mainwindow.ui
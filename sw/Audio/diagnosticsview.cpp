@@ -0,0 +1,46 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : diagnosticsview.cpp
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#include <QScrollBar>
+#include <QFontDatabase>
+#include "diagnosticsview.h"
+
+DiagnosticsView::DiagnosticsView(MetricsServer &metricsServer, QWidget *parent) :
+    QPlainTextEdit(parent),
+    _metricsServer(metricsServer),
+    _timer(this)
+{
+    setReadOnly(true);
+    setLineWrapMode(QPlainTextEdit::NoWrap);
+    setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
+    setWindowTitle("Diagnostics");
+    resize(640, 480);
+
+    connect(&_timer, SIGNAL(timeout()), this, SLOT(refresh()));
+    _timer.setInterval(500);
+}
+
+void DiagnosticsView::refresh()
+{
+    // the text is replaced, the reader keeps the position
+    int position = verticalScrollBar()->value();
+    setPlainText(_metricsServer.getText());
+    verticalScrollBar()->setValue(position);
+}
+
+void DiagnosticsView::showEvent(QShowEvent *event)
+{
+    refresh();
+    _timer.start();
+    QPlainTextEdit::showEvent(event);
+}
+
+void DiagnosticsView::hideEvent(QHideEvent *event)
+{
+    _timer.stop();
+    QPlainTextEdit::hideEvent(event);
+}
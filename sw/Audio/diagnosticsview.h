@@ -0,0 +1,37 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : diagnosticsview.h
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#ifndef DIAGNOSTICSVIEW_H
+#define DIAGNOSTICSVIEW_H
+
+#include <QPlainTextEdit>
+#include <QTimer>
+
+#include "metricsserver.h"
+
+// the text of the metrics endpoint in a window of its own, it is only
+// refreshed while shown
+class DiagnosticsView : public QPlainTextEdit
+{
+    Q_OBJECT
+
+public:
+    explicit DiagnosticsView(MetricsServer &metricsServer, QWidget *parent = nullptr);
+
+public slots:
+    void refresh();
+
+protected:
+    void showEvent(QShowEvent *event) override;
+    void hideEvent(QHideEvent *event) override;
+
+private:
+    MetricsServer &_metricsServer;
+    QTimer        _timer;
+};
+
+#endif // DIAGNOSTICSVIEW_H
@@ -3,6 +3,8 @@
 // Date      : 27.01.2019
 // Filename  : fader.cpp
 // Changelog : 27.01.2019 - file created
+//             17.10.2026 - scene recall, gain follows the slider position
+//             17.10.2026 - paint time measurement
 //------------------------------------------------------------------------------
 
 #include "fader.h"
@@ -29,15 +31,23 @@ Fader::Fader() :
     _rangedB(40),
     _sliderSpacing(10),
     _numberOfMarkers(8),
-    _gainLevel(0)
+    _gainLevel(0),
+    _paintTime(nullptr)
 {
    _font.setPixelSize(9);
     setFixedSize(QSize(_width, _height));
     setMouseTracking(true);
+    updateGain(getLevel());
+}
+
+void Fader::setPaintTime(LatencyHistogram *histogram)
+{
+    _paintTime = histogram;
 }
 
 void Fader::paintEvent(QPaintEvent *)
 {
+    LatencyScope scope(_paintTime);
     QPainter painter(this);
     painter.setRenderHint(QPainter::Antialiasing);
     painter.setFont(_font);
@@ -82,15 +92,10 @@ void Fader::paintEvent(QPaintEvent *)
     painter.drawLine(_sliderPos+_sliderWidth/2, sliderTop, _sliderPos+_sliderWidth/2, sliderTop+4);
     painter.drawLine(_sliderPos+_sliderWidth/2, sliderTop+_sliderHeight, _sliderPos+_sliderWidth/2, sliderTop+_sliderHeight-4);
 
-    // calculate gain
-    float sliderRange = static_cast<float>(_width-_sliderWidth-2*_sliderSpacing);
-    float level = -_rangedB+static_cast<float>(_rangedB*(_sliderPos-_sliderSpacing)) / sliderRange;
-    updateGain(level);
-
     // draw dB inside slider
     //painter.setPen(_frameColor);
     //QRect dBRect(_sliderPos+_sliderWidth/2-20, _height/2+_lineOffset-10, 40, 20);
-    //painter.drawText(dBRect, Qt::AlignCenter, QString::number(static_cast<double>(level), 'f', 1) + QString(" dB"));
+    //painter.drawText(dBRect, Qt::AlignCenter, QString::number(static_cast<double>(_gainLevel), 'f', 1) + QString(" dB"));
 }
 
 void Fader::updateParam(unsigned int *level)
@@ -104,11 +109,27 @@ void Fader::updateParam(unsigned int *level)
     }
 }
 
+void Fader::recallParam(unsigned int level)
+{
+    // the gain is taken as is, the slider shows it as close as it can
+    float gain = (level >= 80) ? static_cast<float>(-_rangedB) : -static_cast<float>(level)/2;
+    float sliderRange = static_cast<float>(_width-_sliderWidth-2*_sliderSpacing);
+    _sliderPos = _sliderSpacing + qRound((gain+_rangedB) * sliderRange / _rangedB);
+    updateGain(gain);
+    update();
+}
+
 void Fader::updateGain(float level)
 {
     _gainLevel = level;
 }
 
+float Fader::getLevel()
+{
+    float sliderRange = static_cast<float>(_width-_sliderWidth-2*_sliderSpacing);
+    return -_rangedB+static_cast<float>(_rangedB*(_sliderPos-_sliderSpacing)) / sliderRange;
+}
+
 void Fader::mouseMoveEvent(QMouseEvent *event)
 {
     bool updateRequired = false;
@@ -137,6 +158,7 @@ void Fader::mouseMoveEvent(QMouseEvent *event)
         if (_sliderPos > _width-_sliderWidth-_sliderSpacing) {
             _sliderPos =_width-_sliderWidth-_sliderSpacing;
         }
+        updateGain(getLevel());
         updateRequired = true;
     } else {
         _moveValueX = 0;
@@ -3,6 +3,9 @@
 // Date      : 27.01.2019
 // Filename  : fader.h
 // Changelog : 27.01.2019 - file created
+//             17.10.2026 - update element next to the widget
+//             17.10.2026 - scene recall
+//             17.10.2026 - paint time measurement
 //------------------------------------------------------------------------------
 
 #ifndef LEVELSLIDER_H
@@ -11,14 +14,17 @@
 #include <QWidget>
 #include <QMouseEvent>
 #include "iupdateelement.h"
+#include "latencyhistogram.h"
 
-class Fader : public IUpdateElement
+class Fader : public QWidget, public IUpdateElement
 {
     Q_OBJECT
 
 public:
     Fader();
     void updateParam(unsigned int *level) override;
+    void recallParam(unsigned int level) override;
+    void setPaintTime(LatencyHistogram *histogram);
 
 protected:
     void paintEvent(QPaintEvent *event) override;
@@ -27,7 +33,8 @@ protected:
     void mouseReleaseEvent(QMouseEvent *event) override;
 
 private:
-    void updateGain(float level);
+    void  updateGain(float level);
+    float getLevel();
 
     QColor _frameColor;
     QColor _backgroundColor;
@@ -50,6 +57,7 @@ private:
     int    _sliderSpacing;
     int    _numberOfMarkers;
     float  _gainLevel;
+    LatencyHistogram *_paintTime;
 
 };
 
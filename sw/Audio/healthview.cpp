@@ -0,0 +1,67 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : healthview.cpp
+// Changelog : 17.10.2026 - file created
+//             17.10.2026 - timeout and retransmissions added
+//------------------------------------------------------------------------------
+
+#include <QHeaderView>
+#include "healthview.h"
+
+HealthView::HealthView(DeviceManager &deviceManager, QWidget *parent) :
+    QTableWidget(0, 8, parent),
+    _deviceManager(deviceManager),
+    _timer(this)
+{
+    setHorizontalHeaderLabels(QStringList() << "Address" << "RTT [ms]" << "RTO [ms]" << "Loss [%]"
+                                            << "Retries" << "Timeouts" << "Late" << "Pending");
+    verticalHeader()->setVisible(false);
+    horizontalHeader()->setSectionResizeMode(QHeaderView::Stretch);
+    setEditTriggers(QAbstractItemView::NoEditTriggers);
+    setSelectionMode(QAbstractItemView::NoSelection);
+
+    connect(&_timer, SIGNAL(timeout()), this, SLOT(refresh()));
+    _timer.start(500);
+}
+
+void HealthView::refresh()
+{
+    int count = _deviceManager.getSessionCount();
+    if (rowCount() != count) {
+        setRowCount(count);
+    }
+
+    for (int row=0; row<count; row++) {
+        BoardSession *session = _deviceManager.getSession(row);
+        ControlLink::BoardHealth health;
+        session->getHealth(health);
+
+        // requests that failed after all retries, late responses included
+        double loss = 0.0;
+        if (health.requests > 0) {
+            loss = 100.0 * health.timeouts / health.requests;
+        }
+
+        setCell(row, 0, session->getAddress());
+        setCell(row, 1, QString::number(health.roundTripTime / 1000.0, 'f', 2));
+        setCell(row, 2, QString::number(health.timeout / 1000.0, 'f', 2));
+        setCell(row, 3, QString::number(loss, 'f', 1));
+        setCell(row, 4, QString::number(health.retransmits));
+        setCell(row, 5, QString::number(health.timeouts));
+        setCell(row, 6, QString::number(health.latePackets));
+        setCell(row, 7, QString::number(health.pending));
+    }
+}
+
+void HealthView::setCell(int row, int column, QString text)
+{
+    QTableWidgetItem *cell = item(row, column);
+    if (cell == nullptr) {
+        cell = new QTableWidgetItem();
+        setItem(row, column, cell);
+    }
+    if (cell->text() != text) {
+        cell->setText(text);
+    }
+}
@@ -0,0 +1,34 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : healthview.h
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#ifndef HEALTHVIEW_H
+#define HEALTHVIEW_H
+
+#include <QTableWidget>
+#include <QTimer>
+
+#include "devicemanager.h"
+
+// round trip time, loss and timeouts of every board session
+class HealthView : public QTableWidget
+{
+    Q_OBJECT
+
+public:
+    explicit HealthView(DeviceManager &deviceManager, QWidget *parent = nullptr);
+
+public slots:
+    void refresh();
+
+private:
+    void setCell(int row, int column, QString text);
+
+    DeviceManager &_deviceManager;
+    QTimer        _timer;
+};
+
+#endif // HEALTHVIEW_H
@@ -3,18 +3,39 @@
 // Date      : 27.12.2018
 // Filename  : mainwindow.cpp
 // Changelog : 27.12.2018 - file created
+//             17.10.2026 - control link in I/O thread
+//             17.10.2026 - fader write on change
+//             17.10.2026 - device manager with multiple boards
+//             17.10.2026 - read data passed in place
+//             17.10.2026 - meter bridge for additional boards
+//             17.10.2026 - fir coefficient upload
+//             17.10.2026 - telemetry recording
+//             17.10.2026 - registers of the register map, output group added
+//             17.10.2026 - scenes
+//             17.10.2026 - automation playback
+//             17.10.2026 - metrics endpoint and diagnostics
+//             17.10.2026 - board scan
 //------------------------------------------------------------------------------
 
 #include <QStatusBar>
+#include <QFileDialog>
 #include "mainwindow.h"
 #include "ui_mainwindow.h"
+#include "impulseresponse.h"
 
 MainWindow::MainWindow(QWidget *parent) :
     QMainWindow(parent),
-    _udptransfer(this),
+    _recorder(this),
+    _deviceManager(LINK_TRANSPORT_QT, this),
+    _session(_deviceManager.getPrimarySession()),
     //_registerAccess(new RegisterMock()),
-    _registerAccess(new RegisterAccess(_udptransfer)),
-    _updater(_registerAccess, this),
+    _registerAccess(_session),
+    _updater(_session->getUpdater()),
+    _coefficientLoader(_session, this),
+    _automationPlayer(_deviceManager, this),
+    _paintTime(),
+    _metricsServer(_deviceManager, this),
+    _diagnosticsView(_metricsServer),
     _ipAddressLabel("IP Address:"),
     _portLabel("UDP Port:"),
     _ipAddressField(),
@@ -27,19 +48,43 @@ MainWindow::MainWindow(QWidget *parent) :
     _addressField(),
     _dataField(),
     _debugButton("Debug"),
+    _recordButton("Record"),
+    _boardAddressLabel("Board:"),
+    _boardAddressField(),
+    _addBoardButton("Add"),
+    _scanButton("Scan"),
+    _healthView(_deviceManager),
+    _meterBridge(),
+    _loadFirButton("Load FIR"),
+    _normalizationBox(),
+    _saveSceneButton("Save Scene"),
+    _recallSceneButton("Recall Scene"),
+    _automationButton("Play Automation"),
     _meterL("Input L"),
     _meterR("Input R"),
     _levelL(),
     _levelR(),
+    _outMeterL("Output L"),
+    _outMeterR("Output R"),
+    _convLevelL(),
+    _convLevelR(),
     _settingsGroup(new QGroupBox()),
     _registerGroup(new QGroupBox()),
     _inputGroup(new QGroupBox()),
+    _outputGroup(new QGroupBox()),
     _debugGroup(new QGroupBox()),
+    _boardsGroup(new QGroupBox("Boards")),
+    _convolutionGroup(new QGroupBox("Convolution")),
+    _sceneGroup(new QGroupBox("Scenes")),
     _centralWidget(new QWidget(this)),
     _settingsLayout(new QGridLayout()),
     _registerLayout(new QGridLayout()),
     _inputLayout(new QGridLayout()),
+    _outputLayout(new QGridLayout()),
     _debugLayout(new QGridLayout()),
+    _boardsLayout(new QGridLayout()),
+    _convolutionLayout(new QGridLayout()),
+    _sceneLayout(new QGridLayout()),
     _mainLayout(new QGridLayout(_centralWidget)),
     _ui(new Ui::MainWindow)
 {
@@ -52,16 +97,31 @@ MainWindow::MainWindow(QWidget *parent) :
     setupSettings(_settingsGroup);
     setupRegister(_registerGroup);
     setupInput(_inputGroup);
+    setupOutput(_outputGroup);
     setupDebug(_debugGroup);
+    setupBoards(_boardsGroup);
+    setupConvolution(_convolutionGroup);
+    setupScene(_sceneGroup);
 
     _mainLayout->addWidget(_settingsGroup, 0, 0);
     _mainLayout->addWidget(_registerGroup, 1, 0);
     _mainLayout->addWidget(_inputGroup, 2, 0);
-    _mainLayout->addWidget(_debugGroup, 3, 0);
+    _mainLayout->addWidget(_outputGroup, 3, 0);
+    _mainLayout->addWidget(_debugGroup, 4, 0);
+    _mainLayout->addWidget(_boardsGroup, 5, 0);
+    _mainLayout->addWidget(_convolutionGroup, 6, 0);
+    _mainLayout->addWidget(_sceneGroup, 7, 0);
 
     setCentralWidget(_centralWidget);
     setWindowTitle("Audio Control");
     show();
+
+    // local only, e.g. for curl or a prometheus on the same machine
+    _metricsServer.addHistogram("audio_gui_paint_us", "Duration of the paint events of meters and faders.",
+                                &_paintTime);
+    if (!_metricsServer.listen(static_cast<quint16>(MetricsServer::DEFAULT_PORT))) {
+        statusBar()->showMessage("Metrics endpoint not available, port in use", 2000);
+    }
 }
 
 MainWindow::~MainWindow()
@@ -73,18 +133,17 @@ MainWindow::~MainWindow()
   //delete _settingsLayout;
   //delete _registerLayout;
   //delete _debugLayout;
-    delete _registerAccess;
     delete _ui;
 }
 
 void MainWindow::setupSettings(QGroupBox *group)
 {
     _portField.setInputMask("900000");
-    _portField.setText(QString::number(_udptransfer.getPort()));
+    _portField.setText(QString::number(_deviceManager.getControlLink().getPort()));
     _portField.setReadOnly(true);
     _portField.setFrame(false);
     _ipAddressField.setInputMask("900.900.900.900");
-    _ipAddressField.setText(_udptransfer.getAddress());
+    _ipAddressField.setText(_session->getAddress());
     _ipAddressField.setReadOnly(true);
     _ipAddressField.setFrame(false);
 
@@ -127,18 +186,91 @@ void MainWindow::setupInput(QGroupBox *group)
     _inputLayout->addWidget(&_levelR, 1, 1);
     group->setLayout(_inputLayout);
 
-    _updater.addElement(0x04, &_meterL, true);
-    _updater.addElement(0x08, &_meterR, true);
-    _updater.addElement(0x0C, &_levelL, false);
-    _updater.addElement(0x10, &_levelR, false);
+    _updater.addRegister<RegisterMap::InMeterL>(&_meterL);
+    _updater.addRegister<RegisterMap::InMeterR>(&_meterR);
+    _updater.addRegister<RegisterMap::InFaderL>(&_levelL);
+    _updater.addRegister<RegisterMap::InFaderR>(&_levelR);
+    _meterL.setPaintTime(&_paintTime);
+    _meterR.setPaintTime(&_paintTime);
+    _levelL.setPaintTime(&_paintTime);
+    _levelR.setPaintTime(&_paintTime);
+    _updater.setResyncInterval(10000);
+}
+
+void MainWindow::setupOutput(QGroupBox *group)
+{
+    // meters after and faders of the convolution
+    _outputLayout->addWidget(&_outMeterL, 0, 0);
+    _outputLayout->addWidget(&_outMeterR, 0, 1);
+    _outputLayout->addWidget(&_convLevelL, 1, 0);
+    _outputLayout->addWidget(&_convLevelR, 1, 1);
+    group->setLayout(_outputLayout);
+
+    _updater.addRegister<RegisterMap::OutMeterL>(&_outMeterL);
+    _updater.addRegister<RegisterMap::OutMeterR>(&_outMeterR);
+    _updater.addRegister<RegisterMap::ConvFaderL>(&_convLevelL);
+    _updater.addRegister<RegisterMap::ConvFaderR>(&_convLevelR);
+    _outMeterL.setPaintTime(&_paintTime);
+    _outMeterR.setPaintTime(&_paintTime);
+    _convLevelL.setPaintTime(&_paintTime);
+    _convLevelR.setPaintTime(&_paintTime);
 }
 
 void MainWindow::setupDebug(QGroupBox *group)
 {
     _debugLayout->addWidget(&_debugButton, 0, 0);
+    _debugLayout->addWidget(&_recordButton, 0, 1);
     group->setLayout(_debugLayout);
 
+    _deviceManager.setRecorder(&_recorder);
+
     connect(&_debugButton, SIGNAL (released()), this, SLOT (onDebugButtonPressed()));
+    connect(&_recordButton, SIGNAL (released()), this, SLOT (onRecordButtonPressed()));
+}
+
+void MainWindow::setupBoards(QGroupBox *group)
+{
+    _boardAddressField.setInputMask("900.900.900.900");
+
+    _boardsLayout->addWidget(&_boardAddressLabel, 0, 0);
+    _boardsLayout->addWidget(&_boardAddressField, 0, 1);
+    _boardsLayout->addWidget(&_addBoardButton, 0, 2);
+    _boardsLayout->addWidget(&_scanButton, 0, 3);
+    _boardsLayout->addWidget(&_healthView, 1, 0, 1, 4);
+    _boardsLayout->addWidget(&_meterBridge, 2, 0, 1, 4);
+    _meterBridge.setPaintTime(&_paintTime);
+    group->setLayout(_boardsLayout);
+
+    connect(&_addBoardButton, SIGNAL (released()), this, SLOT (onAddBoardButtonPressed()));
+    connect(&_scanButton, SIGNAL (released()), this, SLOT (onScanButtonPressed()));
+    connect(&_deviceManager, SIGNAL (scanFinished()), this, SLOT (onScanFinished()));
+}
+
+void MainWindow::setupConvolution(QGroupBox *group)
+{
+    _normalizationBox.addItem("No normalization", ImpulseResponse::NORMALIZE_NONE);
+    _normalizationBox.addItem("Normalize peak", ImpulseResponse::NORMALIZE_PEAK);
+    _normalizationBox.addItem("Normalize sum", ImpulseResponse::NORMALIZE_SUM);
+
+    _convolutionLayout->addWidget(&_normalizationBox, 0, 0);
+    _convolutionLayout->addWidget(&_loadFirButton, 0, 1);
+    group->setLayout(_convolutionLayout);
+
+    connect(&_loadFirButton, SIGNAL (released()), this, SLOT (onLoadFirButtonPressed()));
+    connect(&_coefficientLoader, SIGNAL (finished(int)), this, SLOT (onFirLoaded(int)));
+}
+
+void MainWindow::setupScene(QGroupBox *group)
+{
+    _sceneLayout->addWidget(&_saveSceneButton, 0, 0);
+    _sceneLayout->addWidget(&_recallSceneButton, 0, 1);
+    _sceneLayout->addWidget(&_automationButton, 0, 2);
+    group->setLayout(_sceneLayout);
+
+    connect(&_saveSceneButton, SIGNAL (released()), this, SLOT (onSaveSceneButtonPressed()));
+    connect(&_recallSceneButton, SIGNAL (released()), this, SLOT (onRecallSceneButtonPressed()));
+    connect(&_automationButton, SIGNAL (released()), this, SLOT (onAutomationButtonPressed()));
+    connect(&_automationPlayer, SIGNAL (finished()), this, SLOT (onAutomationFinished()));
 }
 
 void MainWindow::onChangeSettingsButtonPressed()
@@ -155,11 +287,15 @@ void MainWindow::onChangeSettingsButtonPressed()
     } else {
         _changeSettingsButton.setText("Change");
 
-        settingsChanged |= _udptransfer.setAddress(_ipAddressField.text());
-        settingsChanged |= _udptransfer.setPort(static_cast<quint16>(_portField.text().toInt()));
+        QString address = _ipAddressField.text();
+        settingsChanged |= (address != _session->getAddress());
+        settingsChanged |= _session->setAddress(address);
+        settingsChanged |= _deviceManager.getControlLink().setPort(static_cast<quint16>(_portField.text().toInt()));
     }
 
     if (settingsChanged) {
+        // the new board does not know our fader positions yet
+        _updater.invalidateShadow();
         statusBar()->showMessage("Settings changed", 2000);
     }
 }
@@ -173,15 +309,19 @@ void MainWindow::onReadButtonPressed()
     if (!addressOk) {
         error = AUDIO_ADDRESS_FORMAT_ERROR;
     } else {
-        QVector<quint32> dataVector;
-        QString dataString;
-        error = _registerAccess->read(address, dataVector, 1);
-        if (error == AUDIO_SUCCESS) {
-            dataString.setNum(dataVector.at(0), 16);
-            _dataField.setText(dataString);
-        }
+        // the result is delivered with the next update tick
+        error = _registerAccess->readAsync(address, 1, [this](int readError, const quint32 *data, int length) {
+            if ((readError == AUDIO_SUCCESS) && (length > 0)) {
+                QString dataString;
+                dataString.setNum(data[0], 16);
+                _dataField.setText(dataString);
+            }
+            statusBar()->showMessage(QString("Register read ") + QString(errorToString(readError)), 2000);
+        });
+    }
+    if (error != AUDIO_SUCCESS) {
+        statusBar()->showMessage(QString("Register read ") + QString(errorToString(error)), 2000);
     }
-    statusBar()->showMessage(QString("Register read ") + QString(errorToString(error)), 2000);
 }
 
 void MainWindow::onWriteButtonPressed()
@@ -200,11 +340,177 @@ void MainWindow::onWriteButtonPressed()
         QVector<quint32> dataVector;
         dataVector.append(data);
         error =_registerAccess->write(address, dataVector);
+        // the register may belong to a recalled scene
+        _updater.invalidateSceneShadow();
     }
     statusBar()->showMessage(QString("Register write ") + QString(errorToString(error)), 2000);
 }
 
+void MainWindow::onAddBoardButtonPressed()
+{
+    BoardSession *session = _deviceManager.addBoard(_boardAddressField.text());
+    if (session == nullptr) {
+        statusBar()->showMessage(QString("Board not added"), 2000);
+        return;
+    }
+    addBridgeChannels(session);
+    statusBar()->showMessage(QString("Board ") + session->getAddress() + QString(" added"), 2000);
+}
+
+void MainWindow::onScanButtonPressed()
+{
+    if (!_deviceManager.startScan()) {
+        statusBar()->showMessage(QString("Scan not started"), 2000);
+        return;
+    }
+    _scanButton.setEnabled(false);
+    statusBar()->showMessage(QString("Scanning..."));
+}
+
+void MainWindow::onScanFinished()
+{
+    _scanButton.setEnabled(true);
+    QVector<BoardScanner::Result> results;
+    _deviceManager.getScanResults(results);
+    QVector<BoardSession *> sessions = _deviceManager.addScannedBoards();
+    foreach (BoardSession *session, sessions) {
+        addBridgeChannels(session);
+    }
+    statusBar()->showMessage(QString("Scan done, %1 boards found, %2 added")
+                             .arg(results.length()).arg(sessions.length()), 5000);
+}
+
+void MainWindow::addBridgeChannels(BoardSession *session)
+{
+    // the input meters of additional boards are shown in the meter bridge
+    QString name = session->getAddress().section('.', -1);
+    int channelL = _meterBridge.addChannel(name + " L");
+    int channelR = _meterBridge.addChannel(name + " R");
+    session->getUpdater().addRegister<RegisterMap::InMeterL>(_meterBridge.getChannelElement(channelL));
+    session->getUpdater().addRegister<RegisterMap::InMeterR>(_meterBridge.getChannelElement(channelR));
+}
+
+void MainWindow::onLoadFirButtonPressed()
+{
+    QString fileName = QFileDialog::getOpenFileName(this, "Load impulse response", QString(),
+                                                    "Impulse response (*.wav *.raw *.f32);;All files (*)");
+    if (fileName.isEmpty()) {
+        return;
+    }
+
+    ImpulseResponse response;
+    int error = response.load(fileName);
+    if (error == AUDIO_SUCCESS) {
+        ImpulseResponse::Normalization normalization = static_cast<ImpulseResponse::Normalization>(_normalizationBox.currentData().toInt());
+        quint32 left[CoefficientLoader::TAP_COUNT];
+        quint32 right[CoefficientLoader::TAP_COUNT];
+        response.quantize(0, normalization, left, CoefficientLoader::TAP_COUNT);
+        response.quantize(1, normalization, right, CoefficientLoader::TAP_COUNT);
+        error = _coefficientLoader.load(left, right);
+    }
+    if (error != AUDIO_SUCCESS) {
+        statusBar()->showMessage(QString("FIR load ") + QString(errorToString(error)), 2000);
+        return;
+    }
+    _loadFirButton.setEnabled(false);
+}
+
+void MainWindow::onFirLoaded(int error)
+{
+    _loadFirButton.setEnabled(true);
+    if (error == AUDIO_SUCCESS) {
+        statusBar()->showMessage(QString("FIR loaded to bank %1 in %2 ms").arg(_coefficientLoader.getActiveBank())
+                                 .arg(_coefficientLoader.getLoadTime()), 2000);
+    } else {
+        statusBar()->showMessage(QString("FIR load ") + QString(errorToString(error)), 2000);
+    }
+}
+
+void MainWindow::onRecordButtonPressed()
+{
+    if (_recorder.isRecording()) {
+        int error = _recorder.stop();
+        _recordButton.setText("Record");
+        statusBar()->showMessage(QString("Recording stopped, %1 samples, %2 dropped, ").arg(_recorder.getRecordedSamples())
+                                 .arg(_recorder.getDroppedSamples()) + QString(errorToString(error)), 2000);
+        return;
+    }
+
+    QString fileName = QFileDialog::getSaveFileName(this, "Record telemetry", QString(),
+                                                    "Telemetry capture (*.tlm);;All files (*)");
+    if (fileName.isEmpty()) {
+        return;
+    }
+    int error = _recorder.start(fileName);
+    if (error != AUDIO_SUCCESS) {
+        statusBar()->showMessage(QString("Recording ") + QString(errorToString(error)), 2000);
+        return;
+    }
+    _recordButton.setText("Stop");
+}
+
+void MainWindow::onSaveSceneButtonPressed()
+{
+    QString fileName = QFileDialog::getSaveFileName(this, "Save scene", QString(), "Scene (*.scene);;All files (*)");
+    if (fileName.isEmpty()) {
+        return;
+    }
+    // faders of this window and the registers of the last recall
+    Scene scene;
+    _updater.captureScene(scene);
+    int error = scene.save(fileName);
+    statusBar()->showMessage(QString("Scene save ") + QString(errorToString(error)), 2000);
+}
+
+void MainWindow::onRecallSceneButtonPressed()
+{
+    QString fileName = QFileDialog::getOpenFileName(this, "Recall scene", QString(), "Scene (*.scene);;All files (*)");
+    if (fileName.isEmpty()) {
+        return;
+    }
+    Scene scene;
+    int error = scene.load(fileName);
+    if (error == AUDIO_SUCCESS) {
+        _deviceManager.recallScene(scene);
+    }
+    statusBar()->showMessage(QString("Scene recall ") + QString(errorToString(error)), 2000);
+}
+
+void MainWindow::onAutomationButtonPressed()
+{
+    if (_automationPlayer.isPlaying()) {
+        _automationPlayer.stop();
+        return;
+    }
+    QString fileName = QFileDialog::getOpenFileName(this, "Play automation", QString(),
+                                                    "Automation timeline (*.auto);;All files (*)");
+    if (fileName.isEmpty()) {
+        return;
+    }
+    AutomationTimeline timeline;
+    int error = timeline.load(fileName);
+    if (error == AUDIO_SUCCESS) {
+        error = _automationPlayer.start(timeline);
+    }
+    if (error != AUDIO_SUCCESS) {
+        statusBar()->showMessage(QString("Automation ") + QString(errorToString(error)), 2000);
+        return;
+    }
+    _automationButton.setText("Stop Automation");
+}
+
+void MainWindow::onAutomationFinished()
+{
+    _automationButton.setText("Play Automation");
+    LatencyHistogram &jitter = _automationPlayer.getJitter();
+    statusBar()->showMessage(QString("Automation done, %1 datagrams, p99 %2 us, max %3 us, %4 errors")
+                             .arg(jitter.getCount()).arg(jitter.getPercentile(99)).arg(jitter.getMax())
+                             .arg(_automationPlayer.getErrors()), 5000);
+}
+
 void MainWindow::onDebugButtonPressed()
 {
-    statusBar()->showMessage(QString("Debug Buton pressed"), 2000);
+    // counters and latencies of the control stack, the same text as the metrics endpoint
+    _diagnosticsView.show();
+    _diagnosticsView.raise();
 }
@@ -3,6 +3,16 @@
 // Date      : 27.12.2018
 // Filename  : mainwindow.h
 // Changelog : 27.12.2018 - file created
+//             17.10.2026 - control link in I/O thread
+//             17.10.2026 - device manager with multiple boards
+//             17.10.2026 - meter bridge for additional boards
+//             17.10.2026 - fir coefficient upload
+//             17.10.2026 - telemetry recording
+//             17.10.2026 - output group added
+//             17.10.2026 - scenes
+//             17.10.2026 - automation playback
+//             17.10.2026 - metrics endpoint and diagnostics
+//             17.10.2026 - board scan
 //------------------------------------------------------------------------------
 
 #ifndef MAINWINDOW_H
@@ -14,9 +24,17 @@
 #include <QGridLayout>
 #include <QLabel>
 #include <QGroupBox>
+#include <QComboBox>
 
-#include "udptransfer.h"
-#include "registeraccess.h"
+#include "devicemanager.h"
+#include "healthview.h"
+#include "meterbridge.h"
+#include "coefficientloader.h"
+#include "telemetryrecorder.h"
+#include "automationplayer.h"
+#include "metricsserver.h"
+#include "latencyhistogram.h"
+#include "diagnosticsview.h"
 #include "registermock.h"
 #include "typedefinitions.h"
 #include "meter.h"
@@ -40,16 +58,38 @@ private slots:
     void onReadButtonPressed();
     void onWriteButtonPressed();
     void onDebugButtonPressed();
+    void onAddBoardButtonPressed();
+    void onScanButtonPressed();
+    void onScanFinished();
+    void onLoadFirButtonPressed();
+    void onFirLoaded(int error);
+    void onRecordButtonPressed();
+    void onSaveSceneButtonPressed();
+    void onRecallSceneButtonPressed();
+    void onAutomationButtonPressed();
+    void onAutomationFinished();
 
 private:
     void setupSettings(QGroupBox *group);
     void setupRegister(QGroupBox *group);
     void setupInput(QGroupBox *group);
+    void setupOutput(QGroupBox *group);
     void setupDebug(QGroupBox *group);
+    void setupBoards(QGroupBox *group);
+    void setupConvolution(QGroupBox *group);
+    void setupScene(QGroupBox *group);
+    void addBridgeChannels(BoardSession *session);
 
-    UdpTransfer     _udptransfer;
+    TelemetryRecorder _recorder;
+    DeviceManager   _deviceManager;
+    BoardSession    *_session;
     IRegisterAccess *_registerAccess;
-    Updater         _updater;
+    Updater         &_updater;
+    CoefficientLoader _coefficientLoader;
+    AutomationPlayer _automationPlayer;
+    LatencyHistogram _paintTime;
+    MetricsServer   _metricsServer;
+    DiagnosticsView _diagnosticsView;
 
     QLabel          _ipAddressLabel;
     QLabel          _portLabel;
@@ -65,19 +105,43 @@ private:
     QLineEdit       _dataField;
 
     QPushButton     _debugButton;
+    QPushButton     _recordButton;
+    QLabel          _boardAddressLabel;
+    QLineEdit       _boardAddressField;
+    QPushButton     _addBoardButton;
+    QPushButton     _scanButton;
+    HealthView      _healthView;
+    MeterBridge     _meterBridge;
+    QPushButton     _loadFirButton;
+    QComboBox       _normalizationBox;
+    QPushButton     _saveSceneButton;
+    QPushButton     _recallSceneButton;
+    QPushButton     _automationButton;
     Meter           _meterL;
     Meter           _meterR;
     Fader           _levelL;
     Fader           _levelR;
+    Meter           _outMeterL;
+    Meter           _outMeterR;
+    Fader           _convLevelL;
+    Fader           _convLevelR;
     QGroupBox       *_settingsGroup;
     QGroupBox       *_registerGroup;
     QGroupBox       *_inputGroup;
+    QGroupBox       *_outputGroup;
     QGroupBox       *_debugGroup;
+    QGroupBox       *_boardsGroup;
+    QGroupBox       *_convolutionGroup;
+    QGroupBox       *_sceneGroup;
     QWidget         *_centralWidget;
     QGridLayout     *_settingsLayout;
     QGridLayout     *_registerLayout;
     QGridLayout     *_inputLayout;
+    QGridLayout     *_outputLayout;
     QGridLayout     *_debugLayout;
+    QGridLayout     *_boardsLayout;
+    QGridLayout     *_convolutionLayout;
+    QGridLayout     *_sceneLayout;
     QGridLayout     *_mainLayout;
 
     Ui::MainWindow  *_ui;
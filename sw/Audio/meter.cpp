@@ -3,14 +3,30 @@
 // Date      : 20.01.2019
 // Filename  : meter.cpp
 // Changelog : 20.01.2019 - file created
+//             17.10.2026 - cached dial and needle-only repaint
+//             17.10.2026 - time based ballistics and peak hold
+//             17.10.2026 - update element next to the widget
+//             17.10.2026 - paint time measurement
+//             18.10.2026 - damage of the last needle move
+//             18.10.2026 - reading time comment corrected
 //------------------------------------------------------------------------------
 
 #include "meter.h"
 
 #include <QPainter>
+#include <QPaintEvent>
 #include <QFont>
 #include <QtMath>
 
+namespace {
+    const int   circleRadius = 210;
+    const int   outerRadius = static_cast<int>(circleRadius*9.3/10);
+    const int   innerRadius = static_cast<int>(circleRadius*8.0/10);
+    const int   textRadius = static_cast<int>(circleRadius*8.65/10);
+    const qreal span = 0.8;
+    const int   needleWidth = 5;
+}
+
 Meter::Meter(QString label) :
     _frameColor(230, 230, 230),
     _backgroundColor(0, 100, 220),
@@ -20,51 +36,195 @@ Meter::Meter(QString label) :
     _label(label),
     _width(250),
     _height(90),
-    _level(200),
+    _ballistics(MeterBallistics::TYPE_PEAK),
+    _frameTimer(this),
     _levelBar(-100),
-    _levelDisplay(-100.0f)
+    _holdBar(-100),
+    _dialValid(false),
+    _paintTime(nullptr)
 {
     _labelFont.setPixelSize(12);
     _labelFont.setBold(true);
     _labelFont.setFamily("Tahoma");
     _markerFont.setPixelSize(9);
     setFixedSize(QSize(_width, _height));
+    calculateGeometry();
+    _clock.start();
+    _frameTimer.setInterval(FRAME_INTERVAL);
+    connect(&_frameTimer, SIGNAL(timeout()), this, SLOT(onFrameTimer()));
 }
 
 Meter::~Meter() {}
 
 void Meter::updateParam(unsigned int *level)
 {
-    if (_level < *level) {
-        if (_level < (*level - 2)) {
-            _level = _level + 2;
-        } else {
-            _level = *level;
-        }
-    } else if (_level > *level) {
-        _level = *level;
+    // the reading is stamped when the gui thread takes the result off the
+    // link, not when the response arrived, the needle moves on with the
+    // frame timer until it reached the reading
+    _ballistics.addReading(*level, _clock.elapsed());
+    refresh();
+    if (_ballistics.isMoving() && !_frameTimer.isActive()) {
+        _frameTimer.start();
     }
+}
 
-    _levelDisplay = (_levelDisplay*0.8f) + (-static_cast<float>(_level)/2*0.2f);
+void Meter::setBallistics(MeterBallistics::Type type)
+{
+    _ballistics.setType(type);
+}
 
-    if (_level > 200) {
-        _levelBar = -100;
-    } else {
-        _levelBar = -static_cast<int>(_level)/2;
+void Meter::setPeakHold(int holdMs, double decayDbPerSecond)
+{
+    _ballistics.setPeakHold(holdMs, decayDbPerSecond);
+    refresh();
+}
+
+void Meter::setPaintTime(LatencyHistogram *histogram)
+{
+    _paintTime = histogram;
+}
+
+QRegion Meter::getDamage() const
+{
+    return _damage;
+}
+
+void Meter::onFrameTimer()
+{
+    _ballistics.advance(_clock.elapsed());
+    refresh();
+    if (!_ballistics.isMoving()) {
+        _frameTimer.stop();
     }
-    update();
 }
 
-void Meter::paintEvent(QPaintEvent *)
+void Meter::refresh()
 {
-    int circleRadius = 210;
-    int outerRadius = static_cast<int>(circleRadius*9.3/10);
-    int innerRadius = static_cast<int>(circleRadius*8.0/10);
-    int textRadius = static_cast<int>(circleRadius*8.65/10);
-    int markLength = _height/20;
-    qreal span = 0.8;
+    int levelBar = qBound(-(NEEDLE_POSITIONS-1), qRound(_ballistics.getLevelDb()), 0);
+    int holdBar = qBound(-(NEEDLE_POSITIONS-1), qRound(_ballistics.getHoldDb()), 0);
+
+    // only the area of the old and the new needle and hold mark is repainted
+    if ((levelBar != _levelBar) || (holdBar != _holdBar)) {
+        QRegion damage(getNeedleRect(_levelBar));
+        damage = damage.united(getNeedleRect(_holdBar));
+        _levelBar = levelBar;
+        _holdBar = holdBar;
+        damage = damage.united(getNeedleRect(_levelBar));
+        _damage = damage.united(getNeedleRect(_holdBar));
+        update(_damage);
+    }
+}
+
+void Meter::paintEvent(QPaintEvent *event)
+{
+    LatencyScope scope(_paintTime);
+    if (!_dialValid || (_dial.devicePixelRatio() != devicePixelRatioF())) {
+        renderDial();
+    }
 
     QPainter painter(this);
+
+    // copy the damaged part of the dial
+    QRect rect = event->rect();
+    qreal ratio = _dial.devicePixelRatio();
+    painter.drawPixmap(QRectF(rect), _dial, QRectF(rect.x()*ratio, rect.y()*ratio,
+                                                    rect.width()*ratio, rect.height()*ratio));
+
+    // draw needle
+    const QLineF &needle = _needleLines[_levelBar + NEEDLE_POSITIONS - 1];
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.setPen(QPen(_frameColor, needleWidth));
+    painter.setOpacity(0.3);
+    painter.drawLine(needle);
+
+    painter.setPen(QPen(_barColor, 1));
+    painter.setOpacity(1.0);
+    painter.drawLine(needle);
+
+    // peak hold as the outer part of a needle
+    if (_holdBar > _levelBar) {
+        const QLineF &hold = _needleLines[_holdBar + NEEDLE_POSITIONS - 1];
+        painter.setPen(QPen(_barColor, 2));
+        painter.drawLine(QLineF(hold.p1(), hold.pointAt(0.25)));
+    }
+}
+
+void Meter::resizeEvent(QResizeEvent *)
+{
+    _dialValid = false;
+}
+
+void Meter::changeEvent(QEvent *event)
+{
+    if ((event->type() == QEvent::StyleChange) || (event->type() == QEvent::FontChange) ||
+        (event->type() == QEvent::PaletteChange)) {
+        _dialValid = false;
+        update();
+    }
+    QWidget::changeEvent(event);
+}
+
+void Meter::calculateGeometry()
+{
+    // all lines in widget coordinates, the circle center is below the widget
+    QPointF center(_width/2, circleRadius);
+    int markLength = _height/20;
+
+    // 10 dB marks with labels
+    _majorTicks.clear();
+    _tickLabelRects.clear();
+    for (int tick=0; tick<=10; tick++) {
+        qreal i = -span/2 + tick*span/10;
+        _majorTicks.append(QLineF(static_cast<int>((outerRadius-markLength)*qSin(i*M_PI_2)),
+                                  static_cast<int>((-outerRadius+markLength)*qCos(i*M_PI_2)),
+                                  static_cast<int>((outerRadius+markLength)*qSin(i*M_PI_2)),
+                                  static_cast<int>((-outerRadius-markLength)*qCos(i*M_PI_2))).translated(center));
+        _majorTicks.append(QLineF(static_cast<int>((innerRadius-markLength)*qSin(i*M_PI_2)),
+                                  static_cast<int>((-innerRadius+markLength)*qCos(i*M_PI_2)),
+                                  static_cast<int>((innerRadius+markLength)*qSin(i*M_PI_2)),
+                                  static_cast<int>((-innerRadius-markLength)*qCos(i*M_PI_2))).translated(center));
+        _tickLabelRects.append(QRectF(static_cast<int>((textRadius)*qSin(i*M_PI_2))-10,
+                                      static_cast<int>((-textRadius)*qCos(i*M_PI_2))-10, 20, 20).translated(center));
+    }
+
+    // 2 dB marks
+    _minorTicks.clear();
+    for (int tick=0; tick<=50; tick++) {
+        qreal i = -span/2 + tick*span/50;
+        _minorTicks.append(QLineF(static_cast<int>((outerRadius-markLength/2)*qSin(i*M_PI_2)),
+                                  static_cast<int>((-outerRadius+markLength/2)*qCos(i*M_PI_2)),
+                                  static_cast<int>((outerRadius+markLength/2)*qSin(i*M_PI_2)),
+                                  static_cast<int>((-outerRadius-markLength/2)*qCos(i*M_PI_2))).translated(center));
+    }
+
+    // one needle per possible level
+    _needleLines.clear();
+    _needleRects.clear();
+    for (int levelBar=-(NEEDLE_POSITIONS-1); levelBar<=0; levelBar++) {
+        qreal angle = (span/2 + span/100*levelBar) * M_PI_2;
+        QLineF needle(static_cast<int>((outerRadius+markLength*2)*qSin(angle)),
+                      static_cast<int>((-outerRadius-markLength*2)*qCos(angle)),
+                      static_cast<int>((innerRadius-markLength*2)*qSin(angle)),
+                      static_cast<int>((-innerRadius+markLength*2)*qCos(angle)));
+        needle.translate(center);
+        _needleLines.append(needle);
+
+        // pen width and antialiasing around the line
+        qreal margin = needleWidth/2.0 + 1.0;
+        _needleRects.append(QRectF(needle.p1(), needle.p2()).normalized()
+                            .adjusted(-margin, -margin, margin, margin).toAlignedRect());
+    }
+}
+
+void Meter::renderDial()
+{
+    // rendered in device pixels, sharp on high dpi screens
+    qreal ratio = devicePixelRatioF();
+    _dial = QPixmap(QSize(_width, _height) * ratio);
+    _dial.setDevicePixelRatio(ratio);
+    _dial.fill(Qt::transparent);
+
+    QPainter painter(&_dial);
     painter.setRenderHint(QPainter::Antialiasing);
 
     // draw frame
@@ -87,54 +247,27 @@ void Meter::paintEvent(QPaintEvent *)
     //painter.drawText(textRect, Qt::AlignCenter, QString::number(static_cast<double>(_levelDisplay), 'f', 1) + QString(" dB"));
 
     // draw arc
-    painter.setPen(_frameColor);
-    painter.translate(_width/2, circleRadius);
-    QRect outerArcRect(-outerRadius, -outerRadius, 2*outerRadius, 2*outerRadius);
-    QRect innerArcRect(-innerRadius, -innerRadius, 2*innerRadius, 2*innerRadius);
+    painter.setBrush(Qt::NoBrush);
+    QRect outerArcRect(_width/2-outerRadius, circleRadius-outerRadius, 2*outerRadius, 2*outerRadius);
+    QRect innerArcRect(_width/2-innerRadius, circleRadius-innerRadius, 2*innerRadius, 2*innerRadius);
     painter.drawArc(outerArcRect, static_cast<int>(16*(90-(span/2*90))), static_cast<int>(16*(span*90)));
     painter.drawArc(innerArcRect, static_cast<int>(16*(90-(span/2*90))), static_cast<int>(16*(span*90)));
 
-    // draw 10 dB arc marker lines
+    // draw marker lines
+    painter.drawLines(_majorTicks);
+    painter.drawLines(_minorTicks);
+
     painter.setFont(_markerFont);
     int textdB = -100;
-    for (qreal i=-span/2; i<=(span/2)+(span/20); i+=span/10) {
-        painter.drawLine(static_cast<int>((outerRadius-markLength)*qSin(i*M_PI_2)),
-                         static_cast<int>((-outerRadius+markLength)*qCos(i*M_PI_2)),
-                         static_cast<int>((outerRadius+markLength)*qSin(i*M_PI_2)),
-                         static_cast<int>((-outerRadius-markLength)*qCos(i*M_PI_2)));
-
-        QRect textRect(static_cast<int>((textRadius)*qSin(i*M_PI_2))-10,
-                       static_cast<int>((-textRadius)*qCos(i*M_PI_2))-10, 20, 20);
-        painter.drawText(textRect, Qt::AlignCenter, QString::number(textdB));
+    foreach (const QRectF &labelRect, _tickLabelRects) {
+        painter.drawText(labelRect, Qt::AlignCenter, QString::number(textdB));
         textdB += 10;
-
-        painter.drawLine(static_cast<int>((innerRadius-markLength)*qSin(i*M_PI_2)),
-                         static_cast<int>((-innerRadius+markLength)*qCos(i*M_PI_2)),
-                         static_cast<int>((innerRadius+markLength)*qSin(i*M_PI_2)),
-                         static_cast<int>((-innerRadius-markLength)*qCos(i*M_PI_2)));
     }
 
-    // draw 2dB arc marker lines
-    for (qreal i=-span/2; i<=(span/2)+(span/100); i+=span/50) {
-        painter.drawLine(static_cast<int>((outerRadius-markLength/2)*qSin(i*M_PI_2)),
-                         static_cast<int>((-outerRadius+markLength/2)*qCos(i*M_PI_2)),
-                         static_cast<int>((outerRadius+markLength/2)*qSin(i*M_PI_2)),
-                         static_cast<int>((-outerRadius-markLength/2)*qCos(i*M_PI_2)));
-    }
-
-    // draw needle
-    qreal angle = (span/2 + span/100*_levelBar) * M_PI_2;
-    painter.setPen(QPen(_frameColor, 5));
-    painter.setOpacity(0.3);
-    painter.drawLine(static_cast<int>((outerRadius+markLength*2)*qSin(angle)),
-                     static_cast<int>((-outerRadius-markLength*2)*qCos(angle)),
-                     static_cast<int>((innerRadius-markLength*2)*qSin(angle)),
-                     static_cast<int>((-innerRadius+markLength*2)*qCos(angle)));
+    _dialValid = true;
+}
 
-    painter.setPen(QPen(_barColor, 1));
-    painter.setOpacity(1.0);
-    painter.drawLine(static_cast<int>((outerRadius+markLength*2)*qSin(angle)),
-                     static_cast<int>((-outerRadius-markLength*2)*qCos(angle)),
-                     static_cast<int>((innerRadius-markLength*2)*qSin(angle)),
-                     static_cast<int>((-innerRadius+markLength*2)*qCos(angle)));
+QRect Meter::getNeedleRect(int levelBar)
+{
+    return _needleRects[levelBar + NEEDLE_POSITIONS - 1];
 }
@@ -3,37 +3,78 @@
 // Date      : 20.01.2019
 // Filename  : meter.h
 // Changelog : 20.01.2019 - file created
+//             17.10.2026 - cached dial and needle-only repaint
+//             17.10.2026 - time based ballistics and peak hold
+//             17.10.2026 - update element next to the widget
+//             17.10.2026 - paint time measurement
+//             18.10.2026 - damage of the last needle move
 //------------------------------------------------------------------------------
 
 #ifndef METER_H
 #define METER_H
 
 #include <QWidget>
+#include <QPixmap>
+#include <QRegion>
+#include <QVector>
+#include <QLineF>
+#include <QTimer>
+#include <QElapsedTimer>
 #include "iupdateelement.h"
+#include "meterballistics.h"
+#include "latencyhistogram.h"
 
-class Meter : public IUpdateElement
+class Meter : public QWidget, public IUpdateElement
 {
     Q_OBJECT
 public:
     explicit Meter(QString label);
     ~Meter() override;
     void updateParam(unsigned int *level) override;
+    void setBallistics(MeterBallistics::Type type);
+    void setPeakHold(int holdMs, double decayDbPerSecond);
+    void setPaintTime(LatencyHistogram *histogram);
+    QRegion getDamage() const;
 
 protected:
     void paintEvent(QPaintEvent *event) override;
+    void resizeEvent(QResizeEvent *event) override;
+    void changeEvent(QEvent *event) override;
+
+private slots:
+    void onFrameTimer();
 
 private:
-    QColor       _frameColor;
-    QColor       _backgroundColor;
-    QColor       _barColor;
-    QFont        _labelFont;
-    QFont        _markerFont;
-    QString      _label;
-    int          _width;
-    int          _height;
-    unsigned int _level;
-    int          _levelBar;
-    float        _levelDisplay;
+    static const int NEEDLE_POSITIONS = 101;   // _levelBar from -100 to 0
+    static const int FRAME_INTERVAL   = 16;
+
+    void  refresh();
+    void  calculateGeometry();
+    void  renderDial();
+    QRect getNeedleRect(int levelBar);
+
+    QColor           _frameColor;
+    QColor           _backgroundColor;
+    QColor           _barColor;
+    QFont            _labelFont;
+    QFont            _markerFont;
+    QString          _label;
+    int              _width;
+    int              _height;
+    MeterBallistics  _ballistics;
+    QElapsedTimer    _clock;
+    QTimer           _frameTimer;
+    int              _levelBar;
+    int              _holdBar;
+    QPixmap          _dial;
+    bool             _dialValid;
+    QVector<QLineF>  _majorTicks;
+    QVector<QLineF>  _minorTicks;
+    QVector<QRectF>  _tickLabelRects;
+    QVector<QLineF>  _needleLines;
+    QVector<QRect>   _needleRects;
+    QRegion          _damage;           // area of the last needle move
+    LatencyHistogram *_paintTime;
 };
 
 #endif // METER_H
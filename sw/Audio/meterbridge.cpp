@@ -0,0 +1,314 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : meterbridge.cpp
+// Changelog : 17.10.2026 - file created
+//             17.10.2026 - time based ballistics
+//             17.10.2026 - paint time measurement
+//------------------------------------------------------------------------------
+
+#include "meterbridge.h"
+
+#include <QPainter>
+#include <QPaintEvent>
+#include <QtMath>
+
+namespace {
+    const qreal span = 0.8;
+}
+
+MeterBridgeChannel::MeterBridgeChannel(MeterBridge &meterBridge, int channel) :
+    _meterBridge(meterBridge),
+    _channel(channel)
+{
+
+}
+
+void MeterBridgeChannel::updateParam(unsigned int *level)
+{
+    _meterBridge.setLevel(_channel, *level);
+}
+
+MeterBridge::MeterBridge(QWidget *parent) :
+    QWidget(parent),
+    _frameColor(230, 230, 230),
+    _backgroundColor(0, 100, 220),
+    _barColor(200, 50, 50),
+    _labelFont(),
+    _style(STYLE_BAR),
+    _columns(1),
+    _backgroundValid(false),
+    _frameTimer(this),
+    _dirtyFirst(-1),
+    _dirtyLast(-1),
+    _paintTime(nullptr)
+{
+    _labelFont.setPixelSize(9);
+    _frameTimer.setInterval(FRAME_INTERVAL);
+    connect(&_frameTimer, SIGNAL(timeout()), this, SLOT(onFrameTimer()));
+    _clock.start();
+    setAttribute(Qt::WA_OpaquePaintEvent);
+    calculateGeometry();
+}
+
+MeterBridge::~MeterBridge()
+{
+    foreach (MeterBridgeChannel *element, _elements) {
+        delete element;
+    }
+}
+
+int MeterBridge::addChannel(QString label)
+{
+    int channel = _levels.length();
+    _levels.append(MeterBallistics(MeterBallistics::TYPE_PEAK));
+    _positions.append(getPosition(MeterBallistics::FLOOR_DB));
+    _labels.append(label);
+    _elements.append(new MeterBridgeChannel(*this, channel));
+
+    _backgroundValid = false;
+    setMinimumHeight(((_levels.length() + _columns - 1) / _columns) * CELL_HEIGHT);
+    updateGeometry();
+    update();
+    return channel;
+}
+
+int MeterBridge::getChannelCount()
+{
+    return _levels.length();
+}
+
+IUpdateElement *MeterBridge::getChannelElement(int channel)
+{
+    return _elements.value(channel, nullptr);
+}
+
+void MeterBridge::setLevel(int channel, unsigned int level)
+{
+    if ((channel < 0) || (channel >= _levels.length())) {
+        return;
+    }
+    // the channels move on with the frame timer between the readings
+    _levels[channel].addReading(level, _clock.elapsed());
+    updatePosition(channel);
+    if (_levels[channel].isMoving() && !_frameTimer.isActive()) {
+        _frameTimer.start();
+    }
+}
+
+void MeterBridge::setStyle(Style style)
+{
+    _style = style;
+    for (int channel=0; channel<_levels.length(); channel++) {
+        _positions[channel] = getPosition(_levels[channel].getLevelDb());
+    }
+    _backgroundValid = false;
+    update();
+}
+
+void MeterBridge::setBallistics(MeterBallistics::Type type)
+{
+    for (int channel=0; channel<_levels.length(); channel++) {
+        _levels[channel].setType(type);
+    }
+}
+
+void MeterBridge::setPaintTime(LatencyHistogram *histogram)
+{
+    _paintTime = histogram;
+}
+
+QSize MeterBridge::sizeHint() const
+{
+    int columns = qMax(1, qMin(_levels.length(), 16));
+    int rows = qMax(1, (_levels.length() + columns - 1) / columns);
+    return QSize(columns * CELL_WIDTH, rows * CELL_HEIGHT);
+}
+
+void MeterBridge::paintEvent(QPaintEvent *event)
+{
+    LatencyScope scope(_paintTime);
+    if (!_backgroundValid || (_background.devicePixelRatio() != devicePixelRatioF())) {
+        renderBackground();
+    }
+
+    QPainter painter(this);
+    QRect rect = event->rect();
+    qreal ratio = _background.devicePixelRatio();
+    painter.drawPixmap(QRectF(rect), _background, QRectF(rect.x()*ratio, rect.y()*ratio,
+                                                         rect.width()*ratio, rect.height()*ratio));
+
+    // one pass over all channels, cells outside the damaged area are skipped
+    if (_style == STYLE_BAR) {
+        for (int channel=0; channel<_levels.length(); channel++) {
+            QRect meter = getMeterRect(channel);
+            if (!meter.intersects(rect)) {
+                continue;
+            }
+            int height = _positions[channel];
+            painter.fillRect(meter.left(), meter.bottom()-height+1, meter.width(), height, _barColor);
+        }
+    } else {
+        painter.setRenderHint(QPainter::Antialiasing);
+        painter.setPen(QPen(_barColor, 1.5));
+        for (int channel=0; channel<_levels.length(); channel++) {
+            QRect meter = getMeterRect(channel);
+            if (!meter.intersects(rect)) {
+                continue;
+            }
+            painter.drawLine(_needleLines[_positions[channel]].translated(meter.topLeft()));
+        }
+    }
+}
+
+void MeterBridge::resizeEvent(QResizeEvent *)
+{
+    int columns = qMax(1, width() / CELL_WIDTH);
+    if (columns != _columns) {
+        _columns = columns;
+        setMinimumHeight(((_levels.length() + _columns - 1) / _columns) * CELL_HEIGHT);
+    }
+    _backgroundValid = false;
+}
+
+void MeterBridge::changeEvent(QEvent *event)
+{
+    if ((event->type() == QEvent::StyleChange) || (event->type() == QEvent::FontChange) ||
+        (event->type() == QEvent::PaletteChange)) {
+        _backgroundValid = false;
+        update();
+    }
+    QWidget::changeEvent(event);
+}
+
+void MeterBridge::onFrameTimer()
+{
+    qint64 now = _clock.elapsed();
+    bool moving = false;
+    for (int channel=0; channel<_levels.length(); channel++) {
+        if (_levels[channel].isMoving()) {
+            _levels[channel].advance(now);
+            updatePosition(channel);
+            moving = moving || _levels[channel].isMoving();
+        }
+    }
+
+    if (_dirtyFirst < 0) {
+        if (!moving) {
+            _frameTimer.stop();
+        }
+        return;
+    }
+
+    // the cells between the first and the last changed channel
+    QRect first = getCellRect(_dirtyFirst);
+    QRect last = getCellRect(_dirtyLast);
+    if (first.top() == last.top()) {
+        update(first.united(last));
+    } else {
+        update(QRect(0, first.top(), width(), last.bottom()-first.top()+1));
+    }
+    _dirtyFirst = -1;
+    _dirtyLast = -1;
+}
+
+void MeterBridge::renderBackground()
+{
+    qreal ratio = devicePixelRatioF();
+    _background = QPixmap(size() * ratio);
+    _background.setDevicePixelRatio(ratio);
+    _background.fill(palette().color(backgroundRole()));
+
+    QPainter painter(&_background);
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.setFont(_labelFont);
+
+    for (int channel=0; channel<_levels.length(); channel++) {
+        QRect cell = getCellRect(channel).adjusted(1, 1, -1, -1);
+        QRect meter = getMeterRect(channel);
+
+        painter.setPen(_backgroundColor);
+        painter.setBrush(_backgroundColor);
+        painter.drawRoundedRect(cell, 5, 5);
+
+        // 10 dB marks
+        painter.setPen(_frameColor);
+        if (_style == STYLE_BAR) {
+            for (int mark=0; mark<=10; mark++) {
+                int y = meter.top() + (meter.height()-1)*mark/10;
+                painter.drawLine(meter.left()-3, y, meter.left()-1, y);
+                painter.drawLine(meter.right()+1, y, meter.right()+3, y);
+            }
+        } else {
+            for (int mark=0; mark<=10; mark++) {
+                QLineF needle = _needleLines[mark*(NEEDLE_STEPS-1)/10].translated(meter.topLeft());
+                painter.drawLine(QLineF(needle.pointAt(0.85), needle.p2()));
+            }
+        }
+
+        QRect labelRect(cell.left(), cell.bottom()-LABEL_HEIGHT, cell.width(), LABEL_HEIGHT);
+        painter.drawText(labelRect, Qt::AlignCenter, _labels[channel]);
+    }
+
+    _backgroundValid = true;
+}
+
+void MeterBridge::calculateGeometry()
+{
+    // needle pivot at the bottom center of the meter, long enough to reach
+    // the side at full deflection
+    QRect meter = getMeterRect(0);
+    qreal maxAngle = span/2 * M_PI_2;
+    qreal length = qMin(static_cast<qreal>(meter.height()-2), (meter.width()/2.0) / qSin(maxAngle));
+    QPointF pivot(meter.width()/2.0, meter.height());
+
+    _needleLines.clear();
+    for (int position=0; position<NEEDLE_STEPS; position++) {
+        qreal angle = (span/2 - span/100*position) * M_PI_2;
+        _needleLines.append(QLineF(pivot, pivot + QPointF(length*qSin(angle), -length*qCos(angle))));
+    }
+}
+
+int MeterBridge::getPosition(double levelDb)
+{
+    QRect meter = getMeterRect(0);
+    double fraction = qBound(0.0, (levelDb - MeterBallistics::FLOOR_DB) / -MeterBallistics::FLOOR_DB, 1.0);
+    if (_style == STYLE_BAR) {
+        // bar height in pixels
+        return qRound(meter.height() * fraction);
+    }
+    // needle in 1 dB steps like Meter
+    return qRound((1.0 - fraction) * (NEEDLE_STEPS-1));
+}
+
+void MeterBridge::updatePosition(int channel)
+{
+    int position = getPosition(_levels[channel].getLevelDb());
+    if (position != _positions[channel]) {
+        _positions[channel] = position;
+        markDirty(channel);
+    }
+}
+
+QRect MeterBridge::getCellRect(int channel) const
+{
+    return QRect((channel % _columns) * CELL_WIDTH, (channel / _columns) * CELL_HEIGHT, CELL_WIDTH, CELL_HEIGHT);
+}
+
+QRect MeterBridge::getMeterRect(int channel) const
+{
+    return getCellRect(channel).adjusted(8, 6, -8, -(LABEL_HEIGHT+4));
+}
+
+void MeterBridge::markDirty(int channel)
+{
+    if ((_dirtyFirst < 0) || (channel < _dirtyFirst)) {
+        _dirtyFirst = channel;
+    }
+    if (channel > _dirtyLast) {
+        _dirtyLast = channel;
+    }
+    if (!_frameTimer.isActive()) {
+        _frameTimer.start();
+    }
+}
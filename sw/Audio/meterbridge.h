@@ -0,0 +1,112 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : meterbridge.h
+// Changelog : 17.10.2026 - file created
+//             17.10.2026 - time based ballistics
+//             17.10.2026 - paint time measurement
+//------------------------------------------------------------------------------
+
+#ifndef METERBRIDGE_H
+#define METERBRIDGE_H
+
+#include <QWidget>
+#include <QPixmap>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QVector>
+#include <QLineF>
+#include "iupdateelement.h"
+#include "meterballistics.h"
+#include "latencyhistogram.h"
+
+class MeterBridge;
+
+// feeds one channel of the bridge from the Updater, never shown
+class MeterBridgeChannel : public IUpdateElement
+{
+
+public:
+    MeterBridgeChannel(MeterBridge &meterBridge, int channel);
+    void updateParam(unsigned int *level) override;
+
+private:
+    MeterBridge &_meterBridge;
+    int         _channel;
+};
+
+// many channel meters in one widget, painted in a single pass
+//
+// the levels are kept as arrays over all channels and only the cells of
+// channels whose bar or needle moved are repainted, at most once per frame
+class MeterBridge : public QWidget
+{
+    Q_OBJECT
+
+public:
+    enum Style {
+        STYLE_BAR,
+        STYLE_NEEDLE
+    };
+
+    explicit MeterBridge(QWidget *parent = nullptr);
+    ~MeterBridge() override;
+
+    int             addChannel(QString label);
+    int             getChannelCount();
+    IUpdateElement *getChannelElement(int channel);
+    void            setLevel(int channel, unsigned int level);
+    void            setStyle(Style style);
+    void            setBallistics(MeterBallistics::Type type);
+    void            setPaintTime(LatencyHistogram *histogram);
+    QSize           sizeHint() const override;
+
+protected:
+    void paintEvent(QPaintEvent *event) override;
+    void resizeEvent(QResizeEvent *event) override;
+    void changeEvent(QEvent *event) override;
+
+private slots:
+    void onFrameTimer();
+
+private:
+    static const int CELL_WIDTH       = 40;
+    static const int CELL_HEIGHT      = 120;
+    static const int LABEL_HEIGHT     = 14;
+    static const int NEEDLE_STEPS     = 101;   // 0 dB to -100 dB in 1 dB steps
+    static const int FRAME_INTERVAL   = 16;
+
+    void  renderBackground();
+    void  calculateGeometry();
+    int   getPosition(double levelDb);
+    void  updatePosition(int channel);
+    QRect getCellRect(int channel) const;
+    QRect getMeterRect(int channel) const;
+    void  markDirty(int channel);
+
+    QColor                       _frameColor;
+    QColor                       _backgroundColor;
+    QColor                       _barColor;
+    QFont                        _labelFont;
+    Style                        _style;
+    int                          _columns;
+    QPixmap                      _background;
+    bool                         _backgroundValid;
+    QTimer                       _frameTimer;
+    QElapsedTimer                _clock;
+
+    // one entry per channel
+    QVector<MeterBallistics>     _levels;
+    QVector<int>                 _positions;
+    QVector<QString>             _labels;
+    QVector<MeterBridgeChannel*> _elements;
+
+    // needle relative to the meter rectangle, one per position
+    QVector<QLineF>              _needleLines;
+
+    int                          _dirtyFirst;
+    int                          _dirtyLast;
+    LatencyHistogram             *_paintTime;
+};
+
+#endif // METERBRIDGE_H
@@ -0,0 +1,52 @@
+#-------------------------------------------------
+#
+# Benchmarks of the control path
+#
+#-------------------------------------------------
+
+QT       += core
+QT       += gui
+QT       += network
+QT       += widgets
+
+TARGET = Benchmark
+TEMPLATE = app
+CONFIG += console
+CONFIG -= app_bundle
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+CONFIG += c++11
+
+# the measured classes come from the Core library, the widgets of the
+# control client and the renderer, the loopback responder uses the board
+# model of the simulator
+include(../Core/core.pri)
+INCLUDEPATH += ../Audio ../Simulator ../Renderer
+VPATH += ../Audio ../Simulator ../Renderer
+
+SOURCES += \
+    main.cpp \
+    benchmark.cpp \
+    allocationcounter.cpp \
+    loopbackresponder.cpp \
+    meter.cpp \
+    fader.cpp \
+    fft.cpp \
+    partitionedconvolver.cpp \
+    virtualboard.cpp
+
+HEADERS += \
+    benchmark.h \
+    allocationcounter.h \
+    loopbackresponder.h \
+    meter.h \
+    fader.h \
+    fft.h \
+    partitionedconvolver.h \
+    virtualboard.h
+
+# Default rules for deployment.
+qnx: target.path = /tmp/$${TARGET}/bin
+else: unix:!android: target.path = /opt/$${TARGET}/bin
+!isEmpty(target.path): INSTALLS += target
@@ -0,0 +1,67 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : allocationcounter.cpp
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#include "allocationcounter.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+static std::atomic<quint64> allocations(0);
+static std::atomic<quint64> allocatedBytes(0);
+
+static void *allocate(std::size_t size)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    void *pointer = std::malloc(size ? size : 1);
+    if (pointer == nullptr) {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+// replacements of the global allocation functions, the nothrow variants
+// forward to these
+void *operator new(std::size_t size)
+{
+    return allocate(size);
+}
+
+void *operator new[](std::size_t size)
+{
+    return allocate(size);
+}
+
+void operator delete(void *pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete[](void *pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void *pointer, std::size_t) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete[](void *pointer, std::size_t) noexcept
+{
+    std::free(pointer);
+}
+
+quint64 AllocationCounter::getAllocations()
+{
+    return allocations.load(std::memory_order_relaxed);
+}
+
+quint64 AllocationCounter::getAllocatedBytes()
+{
+    return allocatedBytes.load(std::memory_order_relaxed);
+}
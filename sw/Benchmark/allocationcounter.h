@@ -0,0 +1,22 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : allocationcounter.h
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#ifndef ALLOCATIONCOUNTER_H
+#define ALLOCATIONCOUNTER_H
+
+#include <QtGlobal>
+
+// counts calls of the global operator new of the whole process
+class AllocationCounter
+{
+
+public:
+    static quint64 getAllocations();
+    static quint64 getAllocatedBytes();
+};
+
+#endif // ALLOCATIONCOUNTER_H
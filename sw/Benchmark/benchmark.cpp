@@ -0,0 +1,416 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : benchmark.cpp
+// Changelog : 17.10.2026 - file created
+//             17.10.2026 - biquad design added
+//             17.10.2026 - partitioned convolution added
+//             17.10.2026 - update elements without widget base
+//             17.10.2026 - addresses from the register map
+//             17.10.2026 - batched linux transport
+//             18.10.2026 - paint of the needle damage only
+//------------------------------------------------------------------------------
+
+#include "benchmark.h"
+#include "allocationcounter.h"
+#include "udptransfer.h"
+#ifdef Q_OS_LINUX
+#include "batchtransfer.h"
+#endif
+#include "registeraccess.h"
+#include "packetcodec.h"
+#include "updater.h"
+#include "meter.h"
+#include "fader.h"
+#include "biquaddesigner.h"
+#include "partitionedconvolver.h"
+#include "typedefinitions.h"
+#include <QElapsedTimer>
+#include <QPixmap>
+#include <QtMath>
+#include <algorithm>
+
+Benchmark::Benchmark(int iterations, int durationMs) :
+    _iterations(iterations),
+    _durationMs(durationMs),
+    _address("127.0.0.2"),
+    _port(4660)
+{
+}
+
+void Benchmark::setResponder(QString address, quint16 port)
+{
+    _address = address;
+    _port = port;
+}
+
+QJsonObject Benchmark::summarize(QVector<qint64> &samplesNs)
+{
+    QJsonObject result;
+    if (samplesNs.isEmpty()) {
+        return result;
+    }
+    std::sort(samplesNs.begin(), samplesNs.end());
+    qint64 sum = 0;
+    foreach (qint64 sample, samplesNs) {
+        sum += sample;
+    }
+    int last = samplesNs.length() - 1;
+    result["samples"] = samplesNs.length();
+    result["min_us"] = samplesNs[0] / 1000.0;
+    result["mean_us"] = (sum / samplesNs.length()) / 1000.0;
+    result["p50_us"] = samplesNs[last * 50 / 100] / 1000.0;
+    result["p99_us"] = samplesNs[last * 99 / 100] / 1000.0;
+    result["max_us"] = samplesNs[last] / 1000.0;
+    return result;
+}
+
+void Benchmark::connectTransfer(DatagramTransfer &transfer)
+{
+    transfer.setPort(_port);
+    transfer.setAddress(_address);
+}
+
+QJsonObject Benchmark::runCodec()
+{
+    char packet[PacketCodec::MAX_PACKET_SIZE];
+    char response[PacketCodec::MAX_PACKET_SIZE];
+    quint32 words[MAX_BURST_WORDS];
+    quint32 decoded[MAX_BURST_WORDS];
+    for (int index=0; index<MAX_BURST_WORDS; index++) {
+        words[index] = 0x01010101u * static_cast<quint32>(index);
+    }
+
+    // response of a full burst as eth_ctrl sends it
+    response[0] = 0;
+    response[1] = UDP_READ_RESPONSE;
+    response[2] = static_cast<char>((MAX_BURST_WORDS * REGISTER_SIZE) >> 8);
+    response[3] = static_cast<char>((MAX_BURST_WORDS * REGISTER_SIZE) & 0xff);
+    PacketCodec::storeWords(response + PacketCodec::RESPONSE_HEADER_SIZE, words, MAX_BURST_WORDS);
+    int responseSize = PacketCodec::RESPONSE_HEADER_SIZE + MAX_BURST_WORDS * REGISTER_SIZE;
+
+    // the checksum keeps the compiler from dropping the loops
+    quint32 checksum = 0;
+    quint64 allocations = AllocationCounter::getAllocations();
+    QElapsedTimer timer;
+    timer.start();
+    for (int iteration=0; iteration<_iterations; iteration++) {
+        checksum += static_cast<quint32>(PacketCodec::encodeRead(packet, static_cast<quint8>(iteration), 0x10, MAX_BURST_WORDS));
+    }
+    qint64 readNs = timer.nsecsElapsed();
+
+    timer.restart();
+    for (int iteration=0; iteration<_iterations; iteration++) {
+        checksum += static_cast<quint32>(PacketCodec::encodeWrite(packet, static_cast<quint8>(iteration), 0x10, words, MAX_BURST_WORDS));
+    }
+    qint64 writeNs = timer.nsecsElapsed();
+
+    timer.restart();
+    for (int iteration=0; iteration<_iterations; iteration++) {
+        checksum += static_cast<quint32>(PacketCodec::decodeReadResponse(response, responseSize, decoded, MAX_BURST_WORDS));
+        checksum += decoded[iteration % MAX_BURST_WORDS];
+    }
+    qint64 decodeNs = timer.nsecsElapsed();
+    allocations = AllocationCounter::getAllocations() - allocations;
+
+    QJsonObject result;
+    result["burst_words"] = MAX_BURST_WORDS;
+    result["iterations"] = _iterations;
+    result["encode_read_ns"] = static_cast<double>(readNs) / _iterations;
+    result["encode_write_ns"] = static_cast<double>(writeNs) / _iterations;
+    result["decode_response_ns"] = static_cast<double>(decodeNs) / _iterations;
+    result["allocations_per_packet"] = static_cast<double>(allocations) / (3.0 * _iterations);
+    result["checksum"] = static_cast<double>(checksum);
+    return result;
+}
+
+QJsonObject Benchmark::runBiquadDesign(int bands)
+{
+    // a full eq curve designed and quantized like on every fader move
+    quint32 words[BiquadDesigner::WORDS_PER_BIQUAD];
+    quint32 checksum = 0;
+    QVector<qint64> samples;
+    samples.reserve(_iterations);
+    quint64 allocations = AllocationCounter::getAllocations();
+    QElapsedTimer timer;
+    for (int iteration=0; iteration<_iterations; iteration++) {
+        timer.start();
+        for (int band=0; band<bands; band++) {
+            BiquadDesigner::Band parameters = {BiquadDesigner::TYPE_PEAKING, 31.25 * (1 << band),
+                                               (iteration % 25) - 12.0, 1.41};
+            BiquadDesigner::quantize(BiquadDesigner::design(parameters, 48000.0), words);
+            checksum += words[BiquadDesigner::OFFSET_B0];
+        }
+        samples.append(timer.nsecsElapsed());
+    }
+    allocations = AllocationCounter::getAllocations() - allocations;
+
+    QJsonObject result = summarize(samples);
+    result["bands"] = bands;
+    result["allocations_per_curve"] = static_cast<double>(allocations) / _iterations;
+    result["checksum"] = static_cast<double>(checksum);
+    return result;
+}
+
+QJsonObject Benchmark::runPartitionedConvolution(int taps, int blockSize)
+{
+    // one block of a stereo stream, it has to be done within the block period
+    QVector<float> response(taps);
+    for (int tap=0; tap<taps; tap++) {
+        response[tap] = ((tap * 7919) % 2001 - 1000) / 1000.0f * qPow(0.9995, tap);
+    }
+    PartitionedConvolver left(blockSize);
+    PartitionedConvolver right(blockSize);
+    left.setImpulseResponse(response.constData(), taps);
+    right.setImpulseResponse(response.constData(), taps);
+    QVector<float> input(left.getBlockSize());
+    QVector<float> output(left.getBlockSize());
+    for (int sample=0; sample<input.length(); sample++) {
+        input[sample] = ((sample * 31) % 64 - 32) / 32.0f;
+    }
+
+    float checksum = 0.0f;
+    QVector<qint64> samples;
+    samples.reserve(_iterations);
+    quint64 allocations = AllocationCounter::getAllocations();
+    QElapsedTimer timer;
+    for (int iteration=0; iteration<_iterations; iteration++) {
+        timer.start();
+        left.process(input.constData(), output.data());
+        checksum += output[0];
+        right.process(input.constData(), output.data());
+        checksum += output[0];
+        samples.append(timer.nsecsElapsed());
+    }
+    allocations = AllocationCounter::getAllocations() - allocations;
+
+    QJsonObject result = summarize(samples);
+    double periodUs = left.getBlockSize() * 1e6 / 48000.0;
+    result["taps"] = taps;
+    result["block_size"] = left.getBlockSize();
+    result["partitions"] = left.getPartitionCount();
+    result["block_period_us"] = periodUs;
+    // the worst blocks decide whether it keeps up, not the mean
+    result["realtime_load"] = result["p99_us"].toDouble() / periodUs;
+    result["allocations_per_block"] = static_cast<double>(allocations) / _iterations;
+    result["checksum"] = static_cast<double>(checksum);
+    return result;
+}
+
+QJsonObject Benchmark::runRoundTrip()
+{
+    UdpTransfer udpTransfer;
+    connectTransfer(udpTransfer);
+    RegisterAccess registerAccess(udpTransfer);
+    registerAccess.setWindowSize(1);
+
+    // one request at a time, the version register has no side effects
+    QVector<qint64> samples;
+    samples.reserve(_iterations);
+    int errors = 0;
+    QElapsedTimer timer;
+    for (int iteration=0; iteration<_iterations; iteration++) {
+        bool done = false;
+        int readError = AUDIO_SUCCESS;
+        timer.start();
+        registerAccess.readAsync(0x00, 1, [&done, &readError](int error, const quint32 *, int) {
+            readError = error;
+            done = true;
+        });
+        while (!done) {
+            registerAccess.poll(1);
+        }
+        if (readError == AUDIO_SUCCESS) {
+            samples.append(timer.nsecsElapsed());
+        } else {
+            errors++;
+        }
+    }
+
+    QJsonObject result = summarize(samples);
+    result["errors"] = errors;
+    result["smoothed_rtt_us"] = static_cast<double>(registerAccess.getRoundTripTime());
+    return result;
+}
+
+QJsonObject Benchmark::runThroughput(int windowSize, int burstWords)
+{
+    UdpTransfer udpTransfer;
+    return measureThroughput(udpTransfer, windowSize, burstWords);
+}
+
+QJsonObject Benchmark::runBatchThroughput(int windowSize, int burstWords)
+{
+    // empty where the transport is not available
+#ifdef Q_OS_LINUX
+    BatchTransfer batchTransfer;
+    return measureThroughput(batchTransfer, windowSize, burstWords);
+#else
+    Q_UNUSED(windowSize);
+    Q_UNUSED(burstWords);
+    return QJsonObject();
+#endif
+}
+
+QJsonObject Benchmark::measureThroughput(DatagramTransfer &transfer, int windowSize, int burstWords)
+{
+    connectTransfer(transfer);
+    RegisterAccess registerAccess(transfer);
+    registerAccess.setWindowSize(windowSize);
+
+    quint64 registers = 0;
+    quint64 responses = 0;
+    quint64 errors = 0;
+    auto callback = [&registers, &responses, &errors](int error, const quint32 *, int length) {
+        if (error == AUDIO_SUCCESS) {
+            registers += static_cast<quint64>(length);
+            responses++;
+        } else {
+            errors++;
+        }
+    };
+
+    // keep the window full for the whole duration
+    QElapsedTimer timer;
+    timer.start();
+    while (!timer.hasExpired(_durationMs)) {
+        while (registerAccess.getPendingRequests() < 2*windowSize) {
+            registerAccess.readAsync(0x00, burstWords, callback);
+        }
+        registerAccess.poll(1);
+    }
+    qint64 elapsedNs = timer.nsecsElapsed();
+    while (registerAccess.getPendingRequests() > 0) {
+        registerAccess.poll(1);
+    }
+
+    double seconds = elapsedNs / 1e9;
+    QJsonObject result;
+    result["window"] = windowSize;
+    result["burst_words"] = burstWords;
+    result["duration_s"] = seconds;
+    result["requests_per_s"] = responses / seconds;
+    result["registers_per_s"] = registers / seconds;
+    result["errors"] = static_cast<double>(errors);
+    result["timeouts"] = static_cast<double>(registerAccess.getTimeoutCount());
+    result["retransmits"] = static_cast<double>(registerAccess.getRetransmitCount());
+    return result;
+}
+
+QJsonObject Benchmark::runUpdater(int elementCount)
+{
+    UdpTransfer udpTransfer;
+    connectTransfer(udpTransfer);
+    RegisterAccess registerAccess(udpTransfer);
+    Updater updater(&registerAccess, nullptr);
+    updater.setInterval(0);
+
+    // meters and faders of the audio_top register map, repeated
+    const quint32 meterAddresses[] = {RegisterMap::InMeterR::address(), RegisterMap::InMeterL::address(),
+                                      RegisterMap::OutMeterR::address(), RegisterMap::OutMeterL::address()};
+    const quint32 faderAddresses[] = {RegisterMap::InFaderR::address(), RegisterMap::InFaderL::address(),
+                                      RegisterMap::ConvFaderR::address(), RegisterMap::ConvFaderL::address()};
+    QVector<IUpdateElement*> elements;
+    for (int index=0; index<elementCount; index++) {
+        if (index % 2) {
+            Fader *fader = new Fader();
+            updater.addElement(faderAddresses[(index/2) % 4], fader, false);
+            elements.append(fader);
+        } else {
+            Meter *meter = new Meter(QString::number(index));
+            updater.addElement(meterAddresses[(index/2) % 4], meter, true);
+            elements.append(meter);
+        }
+    }
+
+    // the first ticks plan the bursts and grow the buffers
+    for (int tick=0; tick<10; tick++) {
+        updater.update();
+        registerAccess.poll(2);
+    }
+
+    QVector<qint64> samples;
+    samples.reserve(_iterations);
+    quint64 allocations = AllocationCounter::getAllocations();
+    QElapsedTimer timer;
+    for (int tick=0; tick<_iterations; tick++) {
+        timer.start();
+        updater.update();
+        samples.append(timer.nsecsElapsed());
+        // responses arrive between the ticks like with the 20 ms timer
+        registerAccess.poll(2);
+    }
+    allocations = AllocationCounter::getAllocations() - allocations;
+
+    QJsonObject result = summarize(samples);
+    result["elements"] = elementCount;
+    result["allocations_per_tick"] = static_cast<double>(allocations) / _iterations;
+    result["timeouts"] = static_cast<double>(registerAccess.getTimeoutCount());
+    qDeleteAll(elements);
+    return result;
+}
+
+QJsonObject Benchmark::runPaint(QWidget &widget, IUpdateElement *element)
+{
+    // the widgets have a fixed size
+    QPixmap pixmap(widget.size());
+
+    // first paint renders the cached parts
+    widget.render(&pixmap);
+
+    QVector<qint64> samples;
+    samples.reserve(_iterations);
+    quint64 allocations = AllocationCounter::getAllocations();
+    QElapsedTimer timer;
+    for (int iteration=0; iteration<_iterations; iteration++) {
+        if (element != nullptr) {
+            // sweep the needle over the full scale
+            unsigned int level = static_cast<unsigned int>(iteration % 201);
+            element->updateParam(&level);
+        }
+        timer.start();
+        widget.render(&pixmap);
+        samples.append(timer.nsecsElapsed());
+    }
+    allocations = AllocationCounter::getAllocations() - allocations;
+
+    QJsonObject result = summarize(samples);
+    result["width"] = widget.width();
+    result["height"] = widget.height();
+    result["allocations_per_paint"] = static_cast<double>(allocations) / _iterations;
+    return result;
+}
+
+QJsonObject Benchmark::runNeedlePaint(Meter &meter)
+{
+    QPixmap pixmap(meter.size());
+    meter.render(&pixmap);
+
+    QVector<qint64> samples;
+    samples.reserve(_iterations);
+    quint64 allocations = AllocationCounter::getAllocations();
+    qint64 damageArea = 0;
+    QElapsedTimer timer;
+    for (int iteration=0; iteration<_iterations; iteration++) {
+        // alternate between two neighbouring levels like a running meter
+        unsigned int level = static_cast<unsigned int>(100 + (iteration % 2));
+        meter.updateParam(&level);
+
+        // only the area of the old and the new needle, as repainted by refresh()
+        QRegion damage = meter.getDamage();
+        foreach (const QRect &rect, damage) {
+            damageArea += rect.width() * rect.height();
+        }
+        timer.start();
+        meter.render(&pixmap, damage.boundingRect().topLeft(), damage);
+        samples.append(timer.nsecsElapsed());
+    }
+    allocations = AllocationCounter::getAllocations() - allocations;
+
+    QJsonObject result = summarize(samples);
+    result["width"] = meter.width();
+    result["height"] = meter.height();
+    result["damage_pixels"] = static_cast<double>(damageArea) / _iterations;
+    result["allocations_per_paint"] = static_cast<double>(allocations) / _iterations;
+    return result;
+}
@@ -0,0 +1,58 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : benchmark.h
+// Changelog : 17.10.2026 - file created
+//             17.10.2026 - biquad design added
+//             17.10.2026 - partitioned convolution added
+//             17.10.2026 - update elements without widget base
+//             17.10.2026 - batched linux transport
+//             18.10.2026 - paint of the needle damage only
+//------------------------------------------------------------------------------
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <QString>
+#include <QVector>
+#include <QJsonObject>
+
+class QWidget;
+class Meter;
+class IUpdateElement;
+class DatagramTransfer;
+
+// measurements of the control path, every run returns a json object
+//
+// times are in microseconds, allocations are counted with the global
+// operator new and reported per operation
+class Benchmark
+{
+
+public:
+    Benchmark(int iterations, int durationMs);
+
+    void        setResponder(QString address, quint16 port);
+
+    QJsonObject runCodec();
+    QJsonObject runBiquadDesign(int bands);
+    QJsonObject runPartitionedConvolution(int taps, int blockSize);
+    QJsonObject runRoundTrip();
+    QJsonObject runThroughput(int windowSize, int burstWords);
+    QJsonObject runBatchThroughput(int windowSize, int burstWords);
+    QJsonObject runUpdater(int elementCount);
+    QJsonObject runPaint(QWidget &widget, IUpdateElement *element);
+    QJsonObject runNeedlePaint(Meter &meter);
+
+private:
+    static QJsonObject summarize(QVector<qint64> &samplesNs);
+    void               connectTransfer(DatagramTransfer &transfer);
+    QJsonObject        measureThroughput(DatagramTransfer &transfer, int windowSize, int burstWords);
+
+    int     _iterations;
+    int     _durationMs;
+    QString _address;
+    quint16 _port;
+};
+
+#endif // BENCHMARK_H
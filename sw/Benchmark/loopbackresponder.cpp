@@ -0,0 +1,76 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : loopbackresponder.cpp
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#include "loopbackresponder.h"
+#include <QUdpSocket>
+
+LoopbackResponder::LoopbackResponder(QString address, quint16 port, QObject *parent) :
+    QThread(parent),
+    _address(address),
+    _port(port),
+    _board(1),
+    _running(true),
+    _bindState(0),
+    _requestCount(0)
+{
+}
+
+LoopbackResponder::~LoopbackResponder()
+{
+    stop();
+    wait();
+}
+
+void LoopbackResponder::stop()
+{
+    _running = false;
+}
+
+bool LoopbackResponder::waitForBind()
+{
+    while (_bindState == 0) {
+        QThread::msleep(1);
+    }
+    return _bindState > 0;
+}
+
+quint32 LoopbackResponder::getRequestCount()
+{
+    return _requestCount;
+}
+
+void LoopbackResponder::run()
+{
+    QUdpSocket socket;
+    if (!socket.bind(QHostAddress(_address), _port)) {
+        _bindState = -1;
+        return;
+    }
+    _bindState = 1;
+
+    char request[VirtualBoard::MAX_PACKET_SIZE];
+    char response[VirtualBoard::MAX_PACKET_SIZE];
+    QHostAddress sender;
+    quint16 senderPort = 0;
+    while (_running) {
+        // short wait so stop() is noticed
+        if (!socket.waitForReadyRead(10)) {
+            continue;
+        }
+        while (socket.hasPendingDatagrams()) {
+            qint64 size = socket.readDatagram(request, sizeof(request), &sender, &senderPort);
+            if (size < 1) {
+                continue;
+            }
+            _requestCount++;
+            int responseSize = 0;
+            if (_board.handlePacket(request, static_cast<int>(size), response, responseSize) != VirtualBoard::RESULT_NONE) {
+                socket.writeDatagram(response, responseSize, sender, senderPort);
+            }
+        }
+    }
+}
@@ -0,0 +1,41 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : loopbackresponder.h
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#ifndef LOOPBACKRESPONDER_H
+#define LOOPBACKRESPONDER_H
+
+#include <QThread>
+#include <QString>
+#include <atomic>
+#include "virtualboard.h"
+
+// answers eth_ctrl requests as fast as possible from its own thread
+class LoopbackResponder : public QThread
+{
+    Q_OBJECT
+
+public:
+    LoopbackResponder(QString address, quint16 port, QObject *parent = nullptr);
+    ~LoopbackResponder() override;
+
+    void    stop();
+    bool    waitForBind();
+    quint32 getRequestCount();
+
+protected:
+    void run() override;
+
+private:
+    QString              _address;
+    quint16              _port;
+    VirtualBoard         _board;
+    std::atomic<bool>    _running;
+    std::atomic<int>     _bindState;     // 0 pending, 1 bound, -1 failed
+    std::atomic<quint32> _requestCount;
+};
+
+#endif // LOOPBACKRESPONDER_H
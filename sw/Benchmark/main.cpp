@@ -0,0 +1,124 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : main.cpp
+// Changelog : 17.10.2026 - file created
+//             17.10.2026 - biquad design added
+//             17.10.2026 - partitioned convolution added
+//             17.10.2026 - update elements without widget base
+//             17.10.2026 - batched linux transport
+//             18.10.2026 - allocations of the update tick fail the run
+//             18.10.2026 - paint of the needle damage only
+//------------------------------------------------------------------------------
+
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QDateTime>
+#include <QFile>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTextStream>
+#include "benchmark.h"
+#include "loopbackresponder.h"
+#include "meter.h"
+#include "fader.h"
+
+int main(int argc, char *argv[])
+{
+    // widgets are painted without a display
+    if (!qEnvironmentVariableIsSet("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+    QApplication app(argc, argv);
+    QApplication::setApplicationName("Benchmark");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Benchmarks of the audio control path, results in json");
+    parser.addHelpOption();
+    QCommandLineOption iterationsOption("iterations", "Samples per measurement.", "count", "2000");
+    QCommandLineOption durationOption("duration", "Duration of the throughput runs in ms.", "ms", "2000");
+    QCommandLineOption addressOption("address", "Address of the loopback responder.", "address", "127.0.0.2");
+    QCommandLineOption portOption("port", "UDP port of the loopback responder.", "port", "4660");
+    QCommandLineOption outputOption("output", "Write the results to a file instead of stdout.", "file");
+    QCommandLineOption noNetworkOption("no-network", "Skip the measurements over the loopback responder.");
+    parser.addOptions({iterationsOption, durationOption, addressOption, portOption, outputOption, noNetworkOption});
+    parser.process(app);
+
+    int iterations = qMax(1, parser.value(iterationsOption).toInt());
+    Benchmark benchmark(iterations, parser.value(durationOption).toInt());
+    QString address = parser.value(addressOption);
+    quint16 port = static_cast<quint16>(parser.value(portOption).toUInt());
+    benchmark.setResponder(address, port);
+
+    QJsonObject results;
+    results["codec"] = benchmark.runCodec();
+    results["biquad_design"] = benchmark.runBiquadDesign(10);
+    QJsonObject convolution;
+    convolution["taps_48000_block_64"] = benchmark.runPartitionedConvolution(48000, 64);
+    convolution["taps_48000_block_256"] = benchmark.runPartitionedConvolution(48000, 256);
+    results["partitioned_convolution"] = convolution;
+
+    if (!parser.isSet(noNetworkOption)) {
+        LoopbackResponder responder(address, port);
+        responder.start();
+        if (!responder.waitForBind()) {
+            QTextStream(stderr) << "can not bind responder to " << address << ":" << port << endl;
+            return 1;
+        }
+        results["round_trip"] = benchmark.runRoundTrip();
+        QJsonObject throughput;
+        throughput["window_1"] = benchmark.runThroughput(1, 16);
+        throughput["window_16"] = benchmark.runThroughput(16, 16);
+        throughput["window_64"] = benchmark.runThroughput(64, 16);
+        results["throughput"] = throughput;
+        // single register reads as sent by the polling of many boards
+        QJsonObject batchThroughput;
+        batchThroughput["qt_window_64"] = benchmark.runThroughput(64, 1);
+        batchThroughput["batch_window_64"] = benchmark.runBatchThroughput(64, 1);
+        batchThroughput["batch_window_128"] = benchmark.runBatchThroughput(128, 1);
+        results["batch_throughput"] = batchThroughput;
+        QJsonObject updater;
+        updater["elements_8"] = benchmark.runUpdater(8);
+        updater["elements_64"] = benchmark.runUpdater(64);
+        results["updater"] = updater;
+    }
+
+    // the polling path must not allocate once the buffers have grown
+    bool regression = false;
+    QJsonObject updaterResults = results.value("updater").toObject();
+    foreach (const QString &key, updaterResults.keys()) {
+        if (updaterResults.value(key).toObject().value("allocations_per_tick").toDouble() > 0.0) {
+            QTextStream(stderr) << "regression: update tick of " << key << " allocates" << endl;
+            regression = true;
+        }
+    }
+    results["regression"] = regression;
+
+    QJsonObject paint;
+    Meter meter("L");
+    paint["meter"] = benchmark.runPaint(meter, &meter);
+    paint["meter_needle"] = benchmark.runNeedlePaint(meter);
+    Fader fader;
+    paint["fader"] = benchmark.runPaint(fader, nullptr);
+    results["paint"] = paint;
+
+    QJsonObject document;
+    document["benchmark"] = QString("audio control path");
+    document["timestamp"] = QDateTime::currentDateTimeUtc().toString(Qt::ISODate);
+    document["qt_version"] = QString(qVersion());
+    document["iterations"] = iterations;
+    document["results"] = results;
+    QByteArray json = QJsonDocument(document).toJson(QJsonDocument::Indented);
+
+    if (parser.isSet(outputOption)) {
+        QFile file(parser.value(outputOption));
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+            QTextStream(stderr) << "can not write " << file.fileName() << endl;
+            return 1;
+        }
+        file.write(json);
+    } else {
+        QTextStream(stdout) << QString::fromUtf8(json);
+    }
+    return regression ? 2 : 0;
+}
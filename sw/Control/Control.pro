@@ -0,0 +1,33 @@
+#-------------------------------------------------
+#
+# Register access and polling from the command
+# line, runs on machines without gui
+#
+#-------------------------------------------------
+
+QT       += core
+QT       += network
+QT       -= gui
+
+TARGET = Control
+TEMPLATE = app
+CONFIG += console
+CONFIG -= app_bundle
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+CONFIG += c++11
+
+include(../Core/core.pri)
+
+SOURCES += \
+    main.cpp \
+    controller.cpp
+
+HEADERS += \
+    controller.h
+
+# Default rules for deployment.
+qnx: target.path = /tmp/$${TARGET}/bin
+else: unix:!android: target.path = /opt/$${TARGET}/bin
+!isEmpty(target.path): INSTALLS += target
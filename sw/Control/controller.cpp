@@ -0,0 +1,387 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : controller.cpp
+// Changelog : 17.10.2026 - file created
+//             17.10.2026 - scene capture and recall
+//             17.10.2026 - automation playback
+//             17.10.2026 - metrics endpoint
+//             17.10.2026 - board scan
+//             17.10.2026 - batched linux transport
+//             18.10.2026 - blocking calls allowed on the link
+//             18.10.2026 - recorder, automation and metrics created on demand
+//------------------------------------------------------------------------------
+
+#include "controller.h"
+#include "typedefinitions.h"
+
+#include <QCoreApplication>
+#include <QStringList>
+#include <QThread>
+#include <csignal>
+
+namespace {
+    volatile std::sig_atomic_t stopRequested = 0;
+
+    void requestStop(int)
+    {
+        stopRequested = 1;
+    }
+}
+
+PollElement::PollElement(Controller &controller, int board, quint32 address) :
+    _controller(controller),
+    _board(board),
+    _address(address)
+{
+
+}
+
+void PollElement::updateParam(unsigned int *value)
+{
+    _controller.printValue(_board, _address, *value);
+}
+
+Controller::Controller(LinkTransport transport, QObject *parent) :
+    QObject(parent),
+    _recorder(nullptr),
+    _deviceManager(transport, this),
+    _automationPlayer(nullptr),
+    _metricsServer(nullptr),
+    _stopTimer(this),
+    _signalTimer(this),
+    _out(stdout),
+    _err(stderr),
+    _print(true),
+    _scanning(false)
+{
+    // a command line tool, the commands wait for their results
+    _deviceManager.getControlLink().setBlockingAllowed(true);
+    _stopTimer.setSingleShot(true);
+    connect(&_stopTimer, SIGNAL(timeout()), this, SLOT(onStopTimer()));
+    connect(&_signalTimer, SIGNAL(timeout()), this, SLOT(onSignalTimer()));
+    connect(&_deviceManager, SIGNAL(scanFinished()), this, SLOT(onScanFinished()));
+}
+
+Controller::~Controller()
+{
+    // they use the DeviceManager and are deleted before it
+    delete _metricsServer;
+    delete _automationPlayer;
+    // the recorder stops itself, the Updaters must not keep it
+    _deviceManager.setRecorder(nullptr);
+    delete _recorder;
+    foreach (PollElement *element, _elements) {
+        delete element;
+    }
+}
+
+void Controller::setTarget(QString address, quint16 port)
+{
+    _deviceManager.getPrimarySession()->setAddress(address);
+    _deviceManager.getControlLink().setPort(port);
+}
+
+bool Controller::addBoard(QString address)
+{
+    return _deviceManager.addBoard(address) != nullptr;
+}
+
+int Controller::execute(QString command)
+{
+    QString line = command.section('#', 0, 0).simplified();
+    if (line.isEmpty()) {
+        return AUDIO_SUCCESS;
+    }
+    QStringList fields = line.split(' ');
+
+    QString name = fields.takeFirst().toLower();
+    // scene commands take a file name
+    if ((name == "capture") && (fields.length() == 1)) {
+        return captureScene(fields[0]);
+    } else if ((name == "recall") && (fields.length() == 1)) {
+        return recallScene(fields[0]);
+    } else if ((name == "play") && (fields.length() == 1)) {
+        return playAutomation(fields[0]);
+    } else if ((name == "scan") && fields.isEmpty()) {
+        return scan();
+    }
+    QVector<quint32> values;
+    foreach (const QString &field, fields) {
+        quint32 value = 0;
+        if (!parseNumber(field, value)) {
+            return AUDIO_DATA_FORMAT_ERROR;
+        }
+        values.append(value);
+    }
+
+    if ((name == "read") && (values.length() >= 1) && (values.length() <= 2)) {
+        int count = (values.length() == 2) ? static_cast<int>(values[1]) : 1;
+        QVector<quint32> data;
+        int error = read(values[0], count, data);
+        // eight registers per line, each line starts with its address
+        for (int word=0; word<data.length(); word++) {
+            if ((word % 8) == 0) {
+                if (word > 0) {
+                    _out << endl;
+                }
+                _out << "0x" << QString::number(values[0] + static_cast<quint32>(word*REGISTER_SIZE), 16).rightJustified(8, '0') << ':';
+            }
+            _out << " 0x" << QString::number(data[word], 16).rightJustified(8, '0');
+        }
+        if (!data.isEmpty()) {
+            _out << endl;
+        }
+        return error;
+    } else if ((name == "write") && (values.length() >= 2)) {
+        quint32 address = values.takeFirst();
+        return write(address, values);
+    } else if ((name == "poll") && (values.length() >= 1) && (values.length() <= 2)) {
+        addPoll(values[0], (values.length() == 2) ? static_cast<int>(values[1]) : 1);
+        return AUDIO_SUCCESS;
+    } else if ((name == "wait") && (values.length() == 1)) {
+        QThread::msleep(values[0]);
+        return AUDIO_SUCCESS;
+    }
+    return AUDIO_TYPE_ERROR;
+}
+
+int Controller::runScript(QTextStream &script, QString name)
+{
+    int line = 0;
+    while (!script.atEnd()) {
+        QString command = script.readLine();
+        line++;
+        int error = execute(command);
+        if (error != AUDIO_SUCCESS) {
+            QString message = (error == AUDIO_TYPE_ERROR) ? QString("error: unknown command") : QString(errorToString(error));
+            _err << name << ":" << line << ": " << command.trimmed() << ": " << message << endl;
+            return error;
+        }
+    }
+    return AUDIO_SUCCESS;
+}
+
+void Controller::addPoll(quint32 address, int count)
+{
+    Poll poll;
+    poll.address = address;
+    poll.count = qMax(1, count);
+    _polls.append(poll);
+}
+
+bool Controller::hasPolls()
+{
+    return !_polls.isEmpty();
+}
+
+int Controller::startRecording(QString fileName)
+{
+    // the writer thread only runs when recording
+    if (_recorder == nullptr) {
+        _recorder = new TelemetryRecorder();
+    }
+    int error = _recorder->start(fileName);
+    if (error == AUDIO_SUCCESS) {
+        _deviceManager.setRecorder(_recorder);
+    }
+    return error;
+}
+
+bool Controller::startMetrics(quint16 port)
+{
+    // served by the event loop while polling, on the loopback interface only
+    if (_metricsServer == nullptr) {
+        _metricsServer = new MetricsServer(_deviceManager);
+    }
+    return _metricsServer->listen(port);
+}
+
+void Controller::startPolling(int intervalMs, int durationMs, bool print)
+{
+    // the Updater of every board reads the polled registers in bursts
+    _print = print;
+    for (int index=0; index<_deviceManager.getSessionCount(); index++) {
+        BoardSession *session = _deviceManager.getSession(index);
+        foreach (const Poll &poll, _polls) {
+            for (int word=0; word<poll.count; word++) {
+                quint32 address = poll.address + static_cast<quint32>(word*REGISTER_SIZE);
+                PollElement *element = new PollElement(*this, session->getBoard(), address);
+                session->getUpdater().addElement(address, element, true);
+                _elements.append(element);
+            }
+        }
+    }
+    _deviceManager.setInterval(intervalMs);
+    _clock.start();
+
+    // a daemon is stopped with a signal, the capture file is closed properly then
+    std::signal(SIGINT, requestStop);
+    std::signal(SIGTERM, requestStop);
+    _signalTimer.start(100);
+    if (durationMs > 0) {
+        _stopTimer.start(durationMs);
+    }
+}
+
+void Controller::printValue(int board, quint32 address, quint32 value)
+{
+    if (!_print) {
+        return;
+    }
+    _out << _clock.elapsed() << ' ' << board << " 0x" << QString::number(address, 16).rightJustified(8, '0')
+         << " 0x" << QString::number(value, 16).rightJustified(8, '0') << '\n';
+}
+
+void Controller::onStopTimer()
+{
+    _out.flush();
+    if (_recorder != nullptr) {
+        _recorder->stop();
+    }
+    QCoreApplication::quit();
+}
+
+void Controller::onSignalTimer()
+{
+    // flush the lines of the last interval, a pipe reader sees them in time
+    _out.flush();
+    if (stopRequested) {
+        onStopTimer();
+    }
+}
+
+bool Controller::parseNumber(QString text, quint32 &value)
+{
+    // base 0 takes 0x as hex
+    bool valid = false;
+    value = text.toUInt(&valid, 0);
+    return valid;
+}
+
+int Controller::captureScene(QString fileName)
+{
+    // read back from the primary board, the meters in between are not touched
+    Scene scene;
+    foreach (quint32 address, Scene::getWritableRegisters()) {
+        QVector<quint32> data;
+        int error = read(address, 1, data);
+        if (error != AUDIO_SUCCESS) {
+            return error;
+        }
+        scene.setValue(address, data.value(0));
+    }
+    return scene.save(fileName);
+}
+
+int Controller::recallScene(QString fileName)
+{
+    Scene scene;
+    int error = scene.load(fileName);
+    if (error != AUDIO_SUCCESS) {
+        return error;
+    }
+    // all boards at once, the I/O thread answers every write
+    _deviceManager.recallScene(scene);
+    while (_deviceManager.isRecallPending()) {
+        _deviceManager.getControlLink().poll(1);
+    }
+    return AUDIO_SUCCESS;
+}
+
+int Controller::playAutomation(QString fileName)
+{
+    AutomationTimeline timeline;
+    int error = timeline.load(fileName);
+    if (error == AUDIO_SUCCESS) {
+        // the time critical sender thread is only started for a playback
+        if (_automationPlayer == nullptr) {
+            _automationPlayer = new AutomationPlayer(_deviceManager);
+        }
+        error = _automationPlayer->start(timeline);
+    }
+    if (error != AUDIO_SUCCESS) {
+        return error;
+    }
+    // the end of the playback is signalled through the event loop
+    while (_automationPlayer->isPlaying()) {
+        QCoreApplication::processEvents(QEventLoop::WaitForMoreEvents, 10);
+    }
+    LatencyHistogram &jitter = _automationPlayer->getJitter();
+    _out << "automation: " << jitter.getCount() << " datagrams, p50 " << jitter.getPercentile(50)
+         << " us, p99 " << jitter.getPercentile(99) << " us, max " << jitter.getMax() << " us, "
+         << _automationPlayer->getErrors() << " errors" << endl;
+    return (_automationPlayer->getErrors() == 0) ? AUDIO_SUCCESS : AUDIO_TIMEOUT_ERROR;
+}
+
+int Controller::scan()
+{
+    if (!_deviceManager.startScan()) {
+        return AUDIO_BUSY_ERROR;
+    }
+    // the end of the scan is signalled through the event loop
+    _scanning = true;
+    while (_scanning) {
+        QCoreApplication::processEvents(QEventLoop::WaitForMoreEvents, 10);
+    }
+    QVector<BoardScanner::Result> results;
+    _deviceManager.getScanResults(results);
+    foreach (const BoardScanner::Result &result, results) {
+        _out << result.address << " 0x" << QString::number(result.version, 16).rightJustified(8, '0')
+             << ' ' << result.roundTripTime << " us" << endl;
+    }
+    // polled registers are read from the added boards as well
+    _deviceManager.addScannedBoards();
+    return AUDIO_SUCCESS;
+}
+
+void Controller::onScanFinished()
+{
+    _scanning = false;
+}
+
+int Controller::read(quint32 address, int count, QVector<quint32> &data)
+{
+    // larger reads are split into requests of the maximum transfer size
+    BoardSession *session = _deviceManager.getPrimarySession();
+    int offset = 0;
+    while (offset < count) {
+        int length = qMin(count - offset, MAX_TRANSFER_WORDS);
+        int error = session->read(address + static_cast<quint32>(offset*REGISTER_SIZE), data, length);
+        if (error != AUDIO_SUCCESS) {
+            return error;
+        }
+        offset += length;
+    }
+    return AUDIO_SUCCESS;
+}
+
+int Controller::write(quint32 address, const QVector<quint32> &data)
+{
+    BoardSession *session = _deviceManager.getPrimarySession();
+    int offset = 0;
+    while (offset < data.length()) {
+        int length = qMin(data.length() - offset, MAX_TRANSFER_WORDS);
+        int errorCode = AUDIO_TIMEOUT_ERROR;
+        bool done = false;
+        int error = session->writeAsync(address + static_cast<quint32>(offset*REGISTER_SIZE), data.mid(offset, length),
+                                        [&](int writeError) {
+            errorCode = writeError;
+            done = true;
+        });
+        if (error != AUDIO_SUCCESS) {
+            return error;
+        }
+        // the I/O thread answers every request, at the latest with a timeout
+        while (!done) {
+            session->poll(1);
+        }
+        if (errorCode != AUDIO_SUCCESS) {
+            return errorCode;
+        }
+        offset += length;
+    }
+    // the registers may belong to a recalled scene
+    session->getUpdater().invalidateSceneShadow();
+    return AUDIO_SUCCESS;
+}
@@ -0,0 +1,112 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : controller.h
+// Changelog : 17.10.2026 - file created
+//             17.10.2026 - scene capture and recall
+//             17.10.2026 - automation playback
+//             17.10.2026 - metrics endpoint
+//             17.10.2026 - board scan
+//             17.10.2026 - batched linux transport
+//             18.10.2026 - recorder, automation and metrics created on demand
+//------------------------------------------------------------------------------
+
+#ifndef CONTROLLER_H
+#define CONTROLLER_H
+
+#include <QObject>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QTextStream>
+#include <QVector>
+
+#include "devicemanager.h"
+#include "telemetryrecorder.h"
+#include "automationplayer.h"
+#include "metricsserver.h"
+#include "iupdateelement.h"
+
+class Controller;
+
+// hands the values of a polled register to the Controller
+class PollElement : public IUpdateElement
+{
+
+public:
+    PollElement(Controller &controller, int board, quint32 address);
+    void updateParam(unsigned int *value) override;
+
+private:
+    Controller &_controller;
+    int        _board;
+    quint32    _address;
+};
+
+// scripted register access and continuous polling without gui
+//
+// script commands, one per line, # starts a comment:
+//   read <address> [count]
+//   write <address> <value> [value...]
+//   poll <address> [count]
+//   wait <ms>
+//   capture <file>   writable registers of the first board to a scene file
+//   recall <file>    scene file to all boards, only what differs is written
+//   play <file>      automation timeline on all boards, prints the send jitter
+//   scan             boards in the attached subnets, prints and adds them
+// numbers are decimal or hex with 0x, polled registers are read from all
+// boards once the script is done
+class Controller : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit Controller(LinkTransport transport = LINK_TRANSPORT_QT, QObject *parent = nullptr);
+    ~Controller() override;
+
+    void setTarget(QString address, quint16 port);
+    bool addBoard(QString address);
+    int  execute(QString command);
+    int  runScript(QTextStream &script, QString name);
+    void addPoll(quint32 address, int count);
+    bool hasPolls();
+    int  startRecording(QString fileName);
+    bool startMetrics(quint16 port);
+    void startPolling(int intervalMs, int durationMs, bool print);
+    void printValue(int board, quint32 address, quint32 value);
+
+private slots:
+    void onStopTimer();
+    void onSignalTimer();
+    void onScanFinished();
+
+private:
+    struct Poll {
+        quint32 address;
+        int     count;
+    };
+
+    static bool parseNumber(QString text, quint32 &value);
+    int         read(quint32 address, int count, QVector<quint32> &data);
+    int         write(quint32 address, const QVector<quint32> &data);
+    int         captureScene(QString fileName);
+    int         recallScene(QString fileName);
+    int         playAutomation(QString fileName);
+    int         scan();
+
+    // created by the commands that use them, most runs only read or write
+    TelemetryRecorder     *_recorder;
+    DeviceManager         _deviceManager;
+    AutomationPlayer      *_automationPlayer;
+    MetricsServer         *_metricsServer;
+    QVector<Poll>         _polls;
+    QVector<PollElement*> _elements;
+    QTimer                _stopTimer;
+    QTimer                _signalTimer;
+    QElapsedTimer         _clock;
+    QTextStream           _out;
+    QTextStream           _err;
+    bool                  _print;
+    bool                  _scanning;
+};
+
+#endif // CONTROLLER_H
@@ -0,0 +1,139 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : main.cpp
+// Changelog : 17.10.2026 - file created
+//             17.10.2026 - register map check added
+//             17.10.2026 - metrics endpoint added
+//             17.10.2026 - batch transport option added
+//------------------------------------------------------------------------------
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QHostAddress>
+#include <QFile>
+#include <QTextStream>
+#include "controller.h"
+#include "typedefinitions.h"
+#include "registermap.h"
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("Control");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Register access and polling of audio boards without gui\n\n"
+                                     "commands: read <address> [count], write <address> <value>..., "
+                                     "poll <address> [count], wait <ms>, capture <file>, recall <file>, play <file>, scan");
+    parser.addHelpOption();
+    parser.addPositionalArgument("command", "Command to execute before the script, e.g. read 0x04 2.", "[command...]");
+    QCommandLineOption addressOption("address", "Address of the board.", "address", "192.168.1.100");
+    QCommandLineOption portOption("port", "UDP port of the boards.", "port", "4660");
+    QCommandLineOption boardOption("board", "Address of an additional board to poll, repeat for more boards.", "address");
+    QCommandLineOption scriptOption("script", "File with one command per line, - for stdin.", "file");
+    QCommandLineOption pollOption("poll", "Register to poll continuously, address[:count], repeat for more.", "register");
+    QCommandLineOption intervalOption("interval", "Poll interval in milliseconds.", "ms", "20");
+    QCommandLineOption durationOption("duration", "Poll duration in milliseconds, 0 polls until stopped.", "ms", "0");
+    QCommandLineOption recordOption("record", "Record the polled registers to a telemetry capture.", "file");
+    QCommandLineOption quietOption("quiet", "Do not print the polled values.");
+    QCommandLineOption metricsOption("metrics", "Serve the link metrics on this local TCP port while polling.", "port");
+    QCommandLineOption batchOption("batch", "Send and receive with sendmmsg/recvmmsg in an epoll loop, linux only.");
+    QCommandLineOption checkMapOption("check-map", "Compare the register map with audio_top.vhd and exit.", "file");
+    parser.addOptions({addressOption, portOption, boardOption, scriptOption, pollOption, intervalOption,
+                       durationOption, recordOption, quietOption, metricsOption, batchOption, checkMapOption});
+    parser.process(app);
+
+    QTextStream err(stderr);
+    if (parser.isSet(checkMapOption)) {
+        QStringList differences;
+        int error = RegisterMap::check(parser.value(checkMapOption), differences);
+        if (error != AUDIO_SUCCESS) {
+            err << parser.value(checkMapOption) << ": " << QString(errorToString(error)) << endl;
+            return 1;
+        }
+        foreach (const QString &difference, differences) {
+            err << difference << endl;
+        }
+        return differences.isEmpty() ? 0 : 1;
+    }
+    if (parser.positionalArguments().isEmpty() && !parser.isSet(scriptOption) && !parser.isSet(pollOption)) {
+        parser.showHelp(1);
+    }
+
+    QString address = parser.value(addressOption);
+    if (QHostAddress(address).isNull()) {
+        err << "invalid address " << address << endl;
+        return 1;
+    }
+
+    Controller controller(parser.isSet(batchOption) ? LINK_TRANSPORT_BATCH : LINK_TRANSPORT_QT);
+    controller.setTarget(address, static_cast<quint16>(parser.value(portOption).toUInt()));
+    foreach (const QString &board, parser.values(boardOption)) {
+        if (!controller.addBoard(board)) {
+            err << "board " << board << " not added" << endl;
+            return 1;
+        }
+    }
+
+    if (!parser.positionalArguments().isEmpty()) {
+        QString command = parser.positionalArguments().join(' ');
+        int error = controller.execute(command);
+        if (error != AUDIO_SUCCESS) {
+            QString message = (error == AUDIO_TYPE_ERROR) ? QString("error: unknown command") : QString(errorToString(error));
+            err << command << ": " << message << endl;
+            return 1;
+        }
+    }
+
+    if (parser.isSet(scriptOption)) {
+        QString fileName = parser.value(scriptOption);
+        QFile file(fileName);
+        bool opened = false;
+        if (fileName == "-") {
+            opened = file.open(stdin, QIODevice::ReadOnly);
+        } else {
+            opened = file.open(QIODevice::ReadOnly);
+        }
+        if (!opened) {
+            err << fileName << ": " << QString(errorToString(AUDIO_FILE_ERROR)) << endl;
+            return 1;
+        }
+        QTextStream script(&file);
+        if (controller.runScript(script, fileName) != AUDIO_SUCCESS) {
+            return 1;
+        }
+    }
+
+    foreach (const QString &poll, parser.values(pollOption)) {
+        bool addressValid = false;
+        bool countValid = true;
+        quint32 pollAddress = poll.section(':', 0, 0).toUInt(&addressValid, 0);
+        int count = poll.contains(':') ? poll.section(':', 1, 1).toInt(&countValid, 0) : 1;
+        if (!addressValid || !countValid) {
+            err << "invalid register " << poll << endl;
+            return 1;
+        }
+        controller.addPoll(pollAddress, count);
+    }
+
+    // without registers to poll everything is done
+    if (!controller.hasPolls()) {
+        return 0;
+    }
+    if (parser.isSet(recordOption)) {
+        int error = controller.startRecording(parser.value(recordOption));
+        if (error != AUDIO_SUCCESS) {
+            err << parser.value(recordOption) << ": " << QString(errorToString(error)) << endl;
+            return 1;
+        }
+    }
+    if (parser.isSet(metricsOption) && !controller.startMetrics(static_cast<quint16>(parser.value(metricsOption).toUInt()))) {
+        err << "metrics port " << parser.value(metricsOption) << " not available" << endl;
+        return 1;
+    }
+    controller.startPolling(qMax(1, parser.value(intervalOption).toInt()), parser.value(durationOption).toInt(),
+                            !parser.isSet(quietOption));
+
+    return app.exec();
+}
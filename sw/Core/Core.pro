@@ -0,0 +1,89 @@
+#-------------------------------------------------
+#
+# Protocol, scheduling and data handling of the
+# control client, without widgets so it runs on
+# headless machines as well
+#
+#-------------------------------------------------
+
+QT       += core
+QT       += network
+QT       -= gui
+
+TARGET = Core
+TEMPLATE = lib
+CONFIG += staticlib
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+CONFIG += c++11
+
+SOURCES += \
+    udptransfer.cpp \
+    registeraccess.cpp \
+    updater.cpp \
+    iregisteraccess.cpp \
+    registermock.cpp \
+    linkworker.cpp \
+    controllink.cpp \
+    burstplanner.cpp \
+    boardsession.cpp \
+    devicemanager.cpp \
+    packetcodec.cpp \
+    meterballistics.cpp \
+    impulseresponse.cpp \
+    coefficientloader.cpp \
+    biquaddesigner.cpp \
+    biquaduploader.cpp \
+    telemetryrecorder.cpp \
+    telemetrywriter.cpp \
+    telemetryreader.cpp \
+    registermap.cpp \
+    scene.cpp \
+    latencyhistogram.cpp \
+    automationtimeline.cpp \
+    automationworker.cpp \
+    automationplayer.cpp \
+    metricsserver.cpp \
+    boardscanner.cpp \
+    datagramtransfer.cpp
+
+HEADERS += \
+    udptransfer.h \
+    registeraccess.h \
+    typedefinitions.h \
+    updater.h \
+    iupdateelement.h \
+    iregisteraccess.h \
+    registermock.h \
+    spscqueue.h \
+    linkworker.h \
+    controllink.h \
+    burstplanner.h \
+    boardsession.h \
+    devicemanager.h \
+    packetcodec.h \
+    meterballistics.h \
+    impulseresponse.h \
+    coefficientloader.h \
+    biquaddesigner.h \
+    biquaduploader.h \
+    telemetryformat.h \
+    telemetryrecorder.h \
+    telemetrywriter.h \
+    telemetryreader.h \
+    registermap.h \
+    scene.h \
+    latencyhistogram.h \
+    automationtimeline.h \
+    automationworker.h \
+    automationplayer.h \
+    metricsserver.h \
+    boardscanner.h \
+    datagramtransfer.h
+
+# batched socket backend, sendmmsg/recvmmsg and epoll exist on linux only
+linux {
+    SOURCES += batchtransfer.cpp
+    HEADERS += batchtransfer.h
+}
@@ -0,0 +1,110 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : automationplayer.cpp
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#include <QMap>
+#include "automationplayer.h"
+#include "typedefinitions.h"
+
+AutomationPlayer::AutomationPlayer(DeviceManager &deviceManager, QObject *parent) :
+    QObject(parent),
+    _deviceManager(deviceManager),
+    _thread(this),
+    _worker(new AutomationWorker(deviceManager.getControlLink())),
+    _startErrors(0),
+    _playing(false)
+{
+    _worker->moveToThread(&_thread);
+    connect(&_thread, SIGNAL(finished()), _worker, SLOT(deleteLater()));
+    connect(_worker, SIGNAL(finished()), this, SLOT(onWorkerFinished()));
+    _thread.setObjectName("AutomationPlayer");
+    _thread.start(QThread::TimeCriticalPriority);
+}
+
+AutomationPlayer::~AutomationPlayer()
+{
+    _worker->requestStop();
+    _thread.quit();
+    _thread.wait();
+}
+
+int AutomationPlayer::start(const AutomationTimeline &timeline)
+{
+    if (_playing) {
+        return AUDIO_BUSY_ERROR;
+    }
+    if (timeline.isEmpty()) {
+        return AUDIO_DATA_FORMAT_ERROR;
+    }
+
+    // the timeline addresses the boards by their index in the DeviceManager
+    QVector<int> boards;
+    for (int index=0; index<_deviceManager.getSessionCount(); index++) {
+        boards.append(_deviceManager.getSession(index)->getBoard());
+    }
+    timeline.render(boards, _frames);
+
+    // the faders would write their own values in between
+    for (int index=0; index<_deviceManager.getSessionCount(); index++) {
+        _deviceManager.getSession(index)->getUpdater().setWritesSuspended(true);
+    }
+    _deviceManager.getControlLink().getJitter().clear();
+    _startErrors = _deviceManager.getControlLink().getScheduleErrors();
+    _worker->setFrames(_frames);
+    _playing = true;
+    QMetaObject::invokeMethod(_worker, "play", Qt::QueuedConnection);
+    return AUDIO_SUCCESS;
+}
+
+void AutomationPlayer::stop()
+{
+    // finished() follows once the scheduler thread has stopped
+    _worker->requestStop();
+}
+
+bool AutomationPlayer::isPlaying()
+{
+    return _playing;
+}
+
+LatencyHistogram &AutomationPlayer::getJitter()
+{
+    return _deviceManager.getControlLink().getJitter();
+}
+
+quint32 AutomationPlayer::getErrors()
+{
+    // writes that were not sent or not acknowledged
+    quint32 linkErrors = _deviceManager.getControlLink().getScheduleErrors() - _startErrors;
+    return linkErrors + static_cast<quint32>(_worker->getDroppedBatches());
+}
+
+void AutomationPlayer::onWorkerFinished()
+{
+    // the values reached on every board, also if the playback was stopped
+    QMap<int, Scene> reached;
+    int played = _worker->getPlayedFrames();
+    for (int index=0; index<played; index++) {
+        foreach (const AutomationFrame::Batch &batch, _frames[index].batches) {
+            reached[batch.board].setValues(batch.address, batch.data);
+        }
+    }
+
+    // the faders take them over, nothing is written that the board already has.
+    // a scene recalled during the playback goes out first when the writes
+    // resume, the registers of the automation end with the values it reached
+    for (int index=0; index<_deviceManager.getSessionCount(); index++) {
+        BoardSession *session = _deviceManager.getSession(index);
+        Updater &updater = session->getUpdater();
+        updater.setWritesSuspended(false);
+        if (reached.contains(session->getBoard())) {
+            updater.acknowledgeScene(reached[session->getBoard()]);
+            updater.recallScene(reached[session->getBoard()]);
+        }
+    }
+    _playing = false;
+    emit finished();
+}
@@ -0,0 +1,55 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : automationplayer.h
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#ifndef AUTOMATIONPLAYER_H
+#define AUTOMATIONPLAYER_H
+
+#include <QObject>
+#include <QThread>
+
+#include "automationtimeline.h"
+#include "automationworker.h"
+#include "devicemanager.h"
+
+// plays an AutomationTimeline on all boards of a DeviceManager
+//
+// the timeline is rendered to frames before the start, a scheduler thread
+// sends them at their deadline through the ControlLink. the Updaters do not
+// write during the playback, afterwards the reached values are recalled as
+// scene so the faders show them. the send time error of every datagram is
+// collected in the jitter histogram of the ControlLink
+class AutomationPlayer : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit AutomationPlayer(DeviceManager &deviceManager, QObject *parent = nullptr);
+    ~AutomationPlayer() override;
+
+    int               start(const AutomationTimeline &timeline);
+    void              stop();
+    bool              isPlaying();
+    LatencyHistogram &getJitter();
+    quint32           getErrors();
+
+signals:
+    void finished();
+
+private slots:
+    void onWorkerFinished();
+
+private:
+    DeviceManager            &_deviceManager;
+    QThread                  _thread;
+    AutomationWorker         *_worker;
+    QVector<AutomationFrame> _frames;
+    quint32                  _startErrors;
+    bool                     _playing;
+
+};
+
+#endif // AUTOMATIONPLAYER_H
@@ -0,0 +1,192 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : automationtimeline.cpp
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#include <QFile>
+#include <QTextStream>
+#include <QStringList>
+#include <algorithm>
+#include "automationtimeline.h"
+#include "typedefinitions.h"
+
+AutomationTimeline::AutomationTimeline() :
+    _resolution(DEFAULT_RESOLUTION)
+{
+
+}
+
+void AutomationTimeline::clear()
+{
+    _points.clear();
+}
+
+bool AutomationTimeline::isEmpty() const
+{
+    return _points.isEmpty();
+}
+
+void AutomationTimeline::addPoint(qint64 timeMs, int board, quint32 address, quint32 value, bool step)
+{
+    Point point;
+    point.time = timeMs;
+    point.board = board;
+    point.address = address;
+    point.value = value;
+    point.step = step;
+    _points.append(point);
+}
+
+int AutomationTimeline::load(QString fileName)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return AUDIO_FILE_ERROR;
+    }
+    // the timeline is only replaced by a file that reads without error
+    AutomationTimeline timeline;
+    QTextStream in(&file);
+    while (!in.atEnd()) {
+        QString line = in.readLine().section('#', 0, 0).simplified();
+        if (line.isEmpty()) {
+            continue;
+        }
+        QStringList fields = line.split(' ');
+        if ((fields.length() < 4) || (fields.length() > 5)) {
+            return AUDIO_FILE_FORMAT_ERROR;
+        }
+        bool timeValid = false;
+        bool boardValid = true;
+        bool addressValid = false;
+        bool valueValid = false;
+        qint64 time = fields[0].toLongLong(&timeValid, 0);
+        int board = (fields[1] == "*") ? ALL_BOARDS : fields[1].toInt(&boardValid, 0);
+        quint32 address = fields[2].toUInt(&addressValid, 0);
+        quint32 value = fields[3].toUInt(&valueValid, 0);
+        bool step = (fields.length() == 5);
+        if (!timeValid || (time < 0) || !boardValid || !addressValid || !valueValid ||
+            ((address % REGISTER_SIZE) != 0) || (step && (fields[4] != "step"))) {
+            return AUDIO_FILE_FORMAT_ERROR;
+        }
+        timeline.addPoint(time, board, address, value, step);
+    }
+    _points = timeline._points;
+    return AUDIO_SUCCESS;
+}
+
+qint64 AutomationTimeline::getDuration() const
+{
+    // in ms
+    qint64 duration = 0;
+    foreach (const Point &point, _points) {
+        duration = qMax(duration, point.time);
+    }
+    return duration;
+}
+
+void AutomationTimeline::setResolution(int resolutionMs)
+{
+    _resolution = qMax(1, resolutionMs);
+}
+
+void AutomationTimeline::render(const QVector<int> &boards, QVector<AutomationFrame> &frames) const
+{
+    // everything is computed up front, the scheduler thread only sends
+    frames.clear();
+
+    // a lane is the curve of one register of one board or of all boards
+    QVector<Point> sorted(_points);
+    std::stable_sort(sorted.begin(), sorted.end(), [](const Point &a, const Point &b) {
+        if (a.board != b.board) {
+            return a.board < b.board;
+        }
+        if (a.address != b.address) {
+            return a.address < b.address;
+        }
+        return a.time < b.time;
+    });
+    QVector<Event> events;
+    int first = 0;
+    while (first < sorted.length()) {
+        int end = first;
+        while ((end < sorted.length()) && (sorted[end].board == sorted[first].board) &&
+               (sorted[end].address == sorted[first].address)) {
+            end++;
+        }
+        QVector<Point> lane = sorted.mid(first, end - first);
+        for (int board=0; board<boards.length(); board++) {
+            if ((lane[0].board == ALL_BOARDS) || (lane[0].board == board)) {
+                renderLane(lane, board, events);
+            }
+        }
+        first = end;
+    }
+    std::stable_sort(events.begin(), events.end(), [](const Event &a, const Event &b) {
+        return a.time < b.time;
+    });
+
+    // the events of a board that are due together become as few writes as
+    // possible, registers in between are written again with their last value
+    QVector<Scene> states(boards.length());
+    int index = 0;
+    while (index < events.length()) {
+        qint64 time = events[index].time;
+        QVector<Scene> targets(states);
+        QVector<bool> changed(boards.length(), false);
+        while ((index < events.length()) && (events[index].time == time)) {
+            targets[events[index].board].setValue(events[index].address, events[index].value);
+            changed[events[index].board] = true;
+            index++;
+        }
+        AutomationFrame frame;
+        frame.time = time * 1000000;
+        for (int board=0; board<boards.length(); board++) {
+            if (!changed[board]) {
+                continue;
+            }
+            foreach (const Scene::Run &run, targets[board].diff(states[board], MAX_TRANSFER_WORDS)) {
+                AutomationFrame::Batch batch;
+                batch.board = boards[board];
+                batch.address = run.address;
+                batch.data = run.data;
+                frame.batches.append(batch);
+            }
+            states[board] = targets[board];
+        }
+        if (!frame.batches.isEmpty()) {
+            frames.append(frame);
+        }
+    }
+}
+
+void AutomationTimeline::renderLane(const QVector<Point> &lane, int board, QVector<Event> &events) const
+{
+    // ramps are sampled with the resolution, steps without a change are dropped
+    quint32 last = 0;
+    bool started = false;
+    for (int index=0; index<lane.length(); index++) {
+        const Point &point = lane[index];
+        if ((index > 0) && !point.step) {
+            const Point &previous = lane[index-1];
+            qint64 length = point.time - previous.time;
+            for (qint64 time=previous.time+_resolution; time<point.time; time+=_resolution) {
+                double position = static_cast<double>(time - previous.time) / length;
+                double ramp = previous.value + (static_cast<double>(point.value) - previous.value) * position;
+                quint32 value = static_cast<quint32>(ramp + 0.5);
+                if (value != last) {
+                    Event event = {time, board, point.address, value};
+                    events.append(event);
+                    last = value;
+                }
+            }
+        }
+        if (!started || (point.value != last)) {
+            Event event = {point.time, board, point.address, point.value};
+            events.append(event);
+            last = point.value;
+            started = true;
+        }
+    }
+}
@@ -0,0 +1,74 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : automationtimeline.h
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#ifndef AUTOMATIONTIMELINE_H
+#define AUTOMATIONTIMELINE_H
+
+#include <QVector>
+#include <QString>
+
+#include "scene.h"
+
+// writes of all boards that are due at the same time, each batch is one
+// datagram
+struct AutomationFrame {
+    struct Batch {
+        int              board;     // board of the ControlLink
+        quint32          address;
+        QVector<quint32> data;
+    };
+    qint64         time;            // ns from the start
+    QVector<Batch> batches;
+};
+
+// timestamped parameter curves, e.g. fader moves
+//
+// timeline file, one point per line, # starts a comment:
+//   <time_ms> <board> <address> <value> [step]
+// board is the index of the board in the DeviceManager or * for all boards.
+// the value ramps linearly from the previous point of the same register,
+// step holds the previous value up to the point
+class AutomationTimeline
+{
+
+public:
+    static const int DEFAULT_RESOLUTION = 1;   // ms between ramp steps
+    static const int ALL_BOARDS         = -1;
+
+    AutomationTimeline();
+    void   clear();
+    bool   isEmpty() const;
+    void   addPoint(qint64 timeMs, int board, quint32 address, quint32 value, bool step);
+    int    load(QString fileName);
+    qint64 getDuration() const;
+    void   setResolution(int resolutionMs);
+    void   render(const QVector<int> &boards, QVector<AutomationFrame> &frames) const;
+
+private:
+    struct Point {
+        qint64  time;       // ms
+        int     board;
+        quint32 address;
+        quint32 value;
+        bool    step;
+    };
+
+    struct Event {
+        qint64  time;       // ms
+        int     board;      // index into the boards given to render()
+        quint32 address;
+        quint32 value;
+    };
+
+    void renderLane(const QVector<Point> &lane, int board, QVector<Event> &events) const;
+
+    QVector<Point> _points;
+    int            _resolution;
+
+};
+
+#endif // AUTOMATIONTIMELINE_H
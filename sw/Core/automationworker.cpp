@@ -0,0 +1,95 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : automationworker.cpp
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#include "automationworker.h"
+#include "typedefinitions.h"
+
+#include <chrono>
+#include <thread>
+
+AutomationWorker::AutomationWorker(ControlLink &controlLink) :
+    QObject(nullptr),
+    _controlLink(controlLink),
+    _stopRequested(false),
+    _playedFrames(0),
+    _droppedBatches(0)
+{
+
+}
+
+void AutomationWorker::setFrames(const QVector<AutomationFrame> &frames)
+{
+    // only while not playing, the queued play() call publishes them
+    _frames = frames;
+}
+
+void AutomationWorker::requestStop()
+{
+    _stopRequested.store(true);
+}
+
+int AutomationWorker::getPlayedFrames()
+{
+    return _playedFrames.load();
+}
+
+int AutomationWorker::getDroppedBatches()
+{
+    return _droppedBatches.load();
+}
+
+qint64 AutomationWorker::getTime()
+{
+    // ns of the clock the I/O thread measures the send time with
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void AutomationWorker::play()
+{
+    _stopRequested.store(false);
+    _playedFrames.store(0);
+    _droppedBatches.store(0);
+
+    // the first frame is due a little later, the thread is awake by then
+    qint64 start = getTime() + SPIN_TIME * 1000;
+    for (int index=0; index<_frames.length(); index++) {
+        const AutomationFrame &frame = _frames[index];
+        qint64 deadline = start + frame.time;
+        if (!waitUntil(deadline)) {
+            break;
+        }
+        foreach (const AutomationFrame::Batch &batch, frame.batches) {
+            int error = _controlLink.scheduleWrite(batch.board, batch.address, batch.data.constData(),
+                                                   batch.data.length(), deadline);
+            if (error != AUDIO_SUCCESS) {
+                _droppedBatches.fetch_add(1);
+            }
+        }
+        _playedFrames.store(index + 1);
+    }
+    emit finished();
+}
+
+bool AutomationWorker::waitUntil(qint64 deadline)
+{
+    // false if stopped before the deadline
+    qint64 wake = deadline - SPIN_TIME * 1000;
+    qint64 now = getTime();
+    while (now < wake) {
+        if (_stopRequested.load()) {
+            return false;
+        }
+        qint64 sleep = qMin(wake - now, static_cast<qint64>(STOP_CHECK) * 1000000);
+        std::this_thread::sleep_for(std::chrono::nanoseconds(sleep));
+        now = getTime();
+    }
+    while (getTime() < deadline) {
+        std::this_thread::yield();
+    }
+    return !_stopRequested.load();
+}
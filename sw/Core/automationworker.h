@@ -0,0 +1,57 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : automationworker.h
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#ifndef AUTOMATIONWORKER_H
+#define AUTOMATIONWORKER_H
+
+#include <QObject>
+#include <QVector>
+#include <atomic>
+
+#include "automationtimeline.h"
+#include "controllink.h"
+
+// sends the frames of a timeline at their deadline, lives in the scheduler
+// thread of AutomationPlayer
+//
+// the thread sleeps until shortly before a deadline and spins the rest, the
+// deadlines are absolute on the monotonic clock so late frames do not delay
+// the following ones
+class AutomationWorker : public QObject
+{
+    Q_OBJECT
+
+public:
+    static const int SPIN_TIME  = 500;   // us spun before a deadline
+    static const int STOP_CHECK = 10;    // ms between stop checks while sleeping
+
+    explicit AutomationWorker(ControlLink &controlLink);
+    void setFrames(const QVector<AutomationFrame> &frames);
+    void requestStop();
+    int  getPlayedFrames();
+    int  getDroppedBatches();
+
+    static qint64 getTime();
+
+public slots:
+    void play();
+
+signals:
+    void finished();
+
+private:
+    bool waitUntil(qint64 deadline);
+
+    ControlLink              &_controlLink;
+    QVector<AutomationFrame> _frames;
+    std::atomic<bool>        _stopRequested;
+    std::atomic<int>         _playedFrames;
+    std::atomic<int>         _droppedBatches;
+
+};
+
+#endif // AUTOMATIONWORKER_H
@@ -0,0 +1,319 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : batchtransfer.cpp
+// Changelog : 17.10.2026 - file created
+//             18.10.2026 - send time error of scheduled datagrams
+//             18.10.2026 - timestamp keys reset after send errors
+//------------------------------------------------------------------------------
+
+#include <arpa/inet.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+#include <time.h>
+#include <linux/errqueue.h>
+#include <linux/net_tstamp.h>
+#include "batchtransfer.h"
+
+namespace {
+    const int TIMESTAMP_FLAGS = SOF_TIMESTAMPING_TX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE |
+                                SOF_TIMESTAMPING_OPT_TSONLY;
+}
+
+BatchTransfer::BatchTransfer(QObject *parent) :
+    DatagramTransfer(parent),
+    _socket(-1),
+    _epoll(epoll_create1(EPOLL_CLOEXEC)),
+    _wakeEvent(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)),
+    _sendCount(0),
+    _sentKey(0),
+    _receiveBuffers(BATCH_SIZE)
+{
+    // the headers point to the buffers once, only the lengths change
+    memset(_sendHeaders, 0, sizeof(_sendHeaders));
+    memset(_receiveHeaders, 0, sizeof(_receiveHeaders));
+    for (int index=0; index<BATCH_SIZE; index++) {
+        _sendVectors[index].iov_base = _sendBuffers[index];
+        _sendVectors[index].iov_len = 0;
+        memset(&_sendAddresses[index], 0, sizeof(sockaddr_in));
+        _sendAddresses[index].sin_family = AF_INET;
+        msghdr &sendHeader = _sendHeaders[index].msg_hdr;
+        sendHeader.msg_name = &_sendAddresses[index];
+        sendHeader.msg_namelen = sizeof(sockaddr_in);
+        sendHeader.msg_iov = &_sendVectors[index];
+        sendHeader.msg_iovlen = 1;
+
+        _receiveBuffers[index].resize(PacketCodec::MAX_PACKET_SIZE);
+        msghdr &receiveHeader = _receiveHeaders[index].msg_hdr;
+        receiveHeader.msg_name = &_receiveAddresses[index];
+        receiveHeader.msg_iov = &_receiveVectors[index];
+        receiveHeader.msg_iovlen = 1;
+        receiveHeader.msg_control = _receiveControl[index];
+    }
+    for (int index=0; index<SENT_RING_SIZE; index++) {
+        _sentRing[index].key = 0;
+        _sentRing[index].peer = -1;
+        _sentRing[index].id = 0;
+    }
+
+    epoll_event event;
+    memset(&event, 0, sizeof(event));
+    event.events = EPOLLIN;
+    event.data.fd = _wakeEvent;
+    epoll_ctl(_epoll, EPOLL_CTL_ADD, _wakeEvent, &event);
+    openSocket();
+}
+
+BatchTransfer::~BatchTransfer()
+{
+    closeSocket();
+    close(_wakeEvent);
+    close(_epoll);
+}
+
+void BatchTransfer::openSocket()
+{
+    // blocking sends, a full socket buffer delays the batch instead of
+    // dropping it. receives never block, epoll waits for them
+    _socket = socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+    if (_socket < 0) {
+        return;
+    }
+
+    // receive timestamps with every datagram, send timestamps on the error
+    // queue. without them the time before the system call is used
+    int enable = 1;
+    setsockopt(_socket, SOL_SOCKET, SO_TIMESTAMPNS, &enable, sizeof(enable));
+    int flags = TIMESTAMP_FLAGS | SOF_TIMESTAMPING_OPT_ID;
+    setsockopt(_socket, SOL_SOCKET, SO_TIMESTAMPING, &flags, sizeof(flags));
+    _sentKey = 0;
+
+    sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_port = htons(getPort());
+    // a null host address binds to all interfaces
+    address.sin_addr.s_addr = htonl(getHostAddress().toIPv4Address());
+    bind(_socket, reinterpret_cast<sockaddr *>(&address), sizeof(address));
+
+    epoll_event event;
+    memset(&event, 0, sizeof(event));
+    event.events = EPOLLIN;
+    event.data.fd = _socket;
+    epoll_ctl(_epoll, EPOLL_CTL_ADD, _socket, &event);
+}
+
+void BatchTransfer::closeSocket()
+{
+    if (_socket < 0) {
+        return;
+    }
+    epoll_ctl(_epoll, EPOLL_CTL_DEL, _socket, nullptr);
+    close(_socket);
+    _socket = -1;
+}
+
+void BatchTransfer::resetKeys()
+{
+    // the kernel sets the key counter of a udp socket to 0 when OPT_ID is
+    // switched on, the sent datagrams are forgotten. a report still queued
+    // for one of them may match a new datagram with the same key, its
+    // send time is then taken a little early
+    int flags = TIMESTAMP_FLAGS;
+    setsockopt(_socket, SOL_SOCKET, SO_TIMESTAMPING, &flags, sizeof(flags));
+    flags |= SOF_TIMESTAMPING_OPT_ID;
+    setsockopt(_socket, SOL_SOCKET, SO_TIMESTAMPING, &flags, sizeof(flags));
+    _sentKey = 0;
+    for (int index=0; index<SENT_RING_SIZE; index++) {
+        _sentRing[index].peer = -1;
+    }
+}
+
+void BatchTransfer::updateSocket()
+{
+    // queued datagrams still go to the old target
+    flush();
+    closeSocket();
+    openSocket();
+}
+
+void BatchTransfer::wake()
+{
+    // called by other threads, ends the wait of waitForPacket()
+    quint64 value = 1;
+    ssize_t written = write(_wakeEvent, &value, sizeof(value));
+    Q_UNUSED(written);
+}
+
+qint64 BatchTransfer::getTime()
+{
+    // the clock of the kernel timestamps
+    timespec time;
+    clock_gettime(CLOCK_REALTIME, &time);
+    return static_cast<qint64>(time.tv_sec) * 1000000000 + time.tv_nsec;
+}
+
+void BatchTransfer::sendDatagram(int peer, quint32 address, const char *data, int size, qint64 deadlineNs)
+{
+    // copied as the caller reuses its buffer, sent with the next flush()
+    if ((size < 1) || (size > PacketCodec::MAX_PACKET_SIZE)) {
+        return;
+    }
+    if (_sendCount == BATCH_SIZE) {
+        flush();
+    }
+    int index = _sendCount;
+    memcpy(_sendBuffers[index], data, static_cast<size_t>(size));
+    _sendVectors[index].iov_len = static_cast<size_t>(size);
+    _sendAddresses[index].sin_port = htons(getPort());
+    _sendAddresses[index].sin_addr.s_addr = htonl(address);
+    _sendPackets[index].peer = peer;
+    _sendPackets[index].id = PacketCodec::getId(data);
+    _sendDeadlines[index] = deadlineNs;
+    _sendCount++;
+}
+
+void BatchTransfer::flush()
+{
+    int sent = 0;
+    while ((sent < _sendCount) && (_socket >= 0)) {
+        int count = sendmmsg(_socket, &_sendHeaders[sent], static_cast<unsigned int>(_sendCount - sent), 0);
+        if (count < 0) {
+            if (errno != EINTR) {
+                // e.g. no route to the host, the datagram is lost like on
+                // the network and the read is repeated. _sentKey follows the
+                // key counter of the kernel only as long as every datagram
+                // counts once. depending on where it failed the kernel may
+                // have counted the lost one as well, so both start over
+                sent++;
+                resetKeys();
+            }
+            continue;
+        }
+        qint64 sendNs = getTime();
+        for (int index=sent; index<sent+count; index++) {
+            SentPacket &packet = _sendPackets[index];
+            SentPacket &entry = _sentRing[_sentKey % SENT_RING_SIZE];
+            entry.key = _sentKey;
+            entry.peer = packet.peer;
+            entry.id = packet.id;
+            _sentKey++;
+            if (packet.peer >= 0) {
+                setSendTime(packet.peer, packet.id, sendNs);
+            }
+            recordSendTime(_sendDeadlines[index]);
+        }
+        sent += count;
+    }
+    _sendCount = 0;
+}
+
+void BatchTransfer::waitForPacket(int waitMs)
+{
+    flush();
+    epoll_event events[2];
+    int count = epoll_wait(_epoll, events, 2, waitMs);
+    for (int index=0; index<count; index++) {
+        if (events[index].data.fd == _wakeEvent) {
+            quint64 value = 0;
+            ssize_t received = read(_wakeEvent, &value, sizeof(value));
+            Q_UNUSED(received);
+            continue;
+        }
+        // the send timestamps first, the responses are matched with them
+        if (events[index].events & EPOLLERR) {
+            receiveTimestamps();
+        }
+        if (events[index].events & EPOLLIN) {
+            receive();
+        }
+    }
+    // the responses freed room in the request windows
+    flush();
+}
+
+void BatchTransfer::prepareReceive()
+{
+    // a buffer handed over to a receive slot was replaced by the one of the slot
+    for (int index=0; index<BATCH_SIZE; index++) {
+        _receiveVectors[index].iov_base = _receiveBuffers[index].data();
+        _receiveVectors[index].iov_len = PacketCodec::MAX_PACKET_SIZE;
+        msghdr &header = _receiveHeaders[index].msg_hdr;
+        header.msg_namelen = sizeof(sockaddr_in);
+        header.msg_controllen = CONTROL_SIZE;
+        header.msg_flags = 0;
+    }
+}
+
+void BatchTransfer::receive()
+{
+    quint32 backlog = 0;
+    int count = BATCH_SIZE;
+    while (count == BATCH_SIZE) {
+        prepareReceive();
+        count = recvmmsg(_socket, _receiveHeaders, BATCH_SIZE, MSG_DONTWAIT, nullptr);
+        if (count <= 0) {
+            break;
+        }
+        backlog += static_cast<quint32>(count);
+        for (int index=0; index<count; index++) {
+            msghdr &header = _receiveHeaders[index].msg_hdr;
+            int size = static_cast<int>(_receiveHeaders[index].msg_len);
+            if ((size < 1) || (header.msg_flags & MSG_TRUNC)) {
+                countDroppedPacket();
+                continue;
+            }
+            qint64 receiveNs = 0;
+            for (cmsghdr *message=CMSG_FIRSTHDR(&header); message!=nullptr; message=CMSG_NXTHDR(&header, message)) {
+                if ((message->cmsg_level == SOL_SOCKET) && (message->cmsg_type == SCM_TIMESTAMPNS)) {
+                    timespec time;
+                    memcpy(&time, CMSG_DATA(message), sizeof(time));
+                    receiveNs = static_cast<qint64>(time.tv_sec) * 1000000000 + time.tv_nsec;
+                }
+            }
+            receivePacket(ntohl(_receiveAddresses[index].sin_addr.s_addr), _receiveBuffers[index], size, receiveNs);
+        }
+    }
+    updateReceiveBacklog(backlog);
+}
+
+void BatchTransfer::receiveTimestamps()
+{
+    // one report per sent datagram, the payload is left out (OPT_TSONLY)
+    int count = BATCH_SIZE;
+    while (count == BATCH_SIZE) {
+        prepareReceive();
+        count = recvmmsg(_socket, _receiveHeaders, BATCH_SIZE, MSG_ERRQUEUE | MSG_DONTWAIT, nullptr);
+        if (count <= 0) {
+            break;
+        }
+        for (int index=0; index<count; index++) {
+            msghdr &header = _receiveHeaders[index].msg_hdr;
+            qint64 sendNs = 0;
+            bool keyValid = false;
+            quint32 key = 0;
+            for (cmsghdr *message=CMSG_FIRSTHDR(&header); message!=nullptr; message=CMSG_NXTHDR(&header, message)) {
+                if ((message->cmsg_level == SOL_SOCKET) && (message->cmsg_type == SCM_TIMESTAMPING)) {
+                    scm_timestamping timestamps;
+                    memcpy(&timestamps, CMSG_DATA(message), sizeof(timestamps));
+                    sendNs = static_cast<qint64>(timestamps.ts[0].tv_sec) * 1000000000 + timestamps.ts[0].tv_nsec;
+                } else if ((message->cmsg_level == SOL_IP) && (message->cmsg_type == IP_RECVERR)) {
+                    sock_extended_err error;
+                    memcpy(&error, CMSG_DATA(message), sizeof(error));
+                    if ((error.ee_errno == ENOMSG) && (error.ee_origin == SO_EE_ORIGIN_TIMESTAMPING) &&
+                        (error.ee_info == SCM_TSTAMP_SND)) {
+                        key = error.ee_data;
+                        keyValid = true;
+                    }
+                }
+            }
+            SentPacket &entry = _sentRing[key % SENT_RING_SIZE];
+            if (keyValid && (sendNs > 0) && (entry.key == key) && (entry.peer >= 0)) {
+                setSendTime(entry.peer, entry.id, sendNs);
+            }
+        }
+    }
+}
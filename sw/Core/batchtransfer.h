@@ -0,0 +1,86 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : batchtransfer.h
+// Changelog : 17.10.2026 - file created
+//             18.10.2026 - send time error of scheduled datagrams
+//             18.10.2026 - timestamp keys reset after send errors
+//------------------------------------------------------------------------------
+
+#ifndef BATCHTRANSFER_H
+#define BATCHTRANSFER_H
+
+#include <QVector>
+#include <sys/socket.h>
+#include <netinet/in.h>
+
+#include "datagramtransfer.h"
+#include "packetcodec.h"
+
+// linux transport for many boards, moves up to BATCH_SIZE datagrams per
+// system call with sendmmsg() and recvmmsg()
+//
+// nothing runs in the Qt event loop. sent datagrams are queued until
+// flush() or waitForPacket(), which waits with epoll for the socket or for
+// wake() of another thread and delivers everything received. the kernel
+// stamps the datagrams when they leave and arrive, the round trip time
+// does not include the scheduling delay of the thread
+class BatchTransfer : public DatagramTransfer
+{
+    Q_OBJECT
+
+public:
+    static const int BATCH_SIZE = 64;
+
+    explicit BatchTransfer(QObject *parent = nullptr);
+    ~BatchTransfer() override;
+
+    void waitForPacket(int waitMs) override;
+    void flush() override;
+    void wake();
+
+protected:
+    void sendDatagram(int peer, quint32 address, const char *data, int size, qint64 deadlineNs) override;
+    void updateSocket() override;
+
+private:
+    // sent datagram waiting for its timestamp, the key counts the
+    // datagrams sent on the socket
+    struct SentPacket {
+        quint32 key;
+        int     peer;
+        quint8  id;
+    };
+
+    static const int SENT_RING_SIZE = 1024;
+    static const int CONTROL_SIZE   = 256;
+
+    void   openSocket();
+    void   closeSocket();
+    void   resetKeys();
+    void   prepareReceive();
+    void   receive();
+    void   receiveTimestamps();
+    static qint64 getTime();
+
+    int                 _socket;
+    int                 _epoll;
+    int                 _wakeEvent;
+    int                 _sendCount;
+    quint32             _sentKey;
+    mmsghdr             _sendHeaders[BATCH_SIZE];
+    iovec               _sendVectors[BATCH_SIZE];
+    sockaddr_in         _sendAddresses[BATCH_SIZE];
+    SentPacket          _sendPackets[BATCH_SIZE];
+    qint64              _sendDeadlines[BATCH_SIZE];
+    char                _sendBuffers[BATCH_SIZE][PacketCodec::MAX_PACKET_SIZE];
+    SentPacket          _sentRing[SENT_RING_SIZE];
+    mmsghdr             _receiveHeaders[BATCH_SIZE];
+    iovec               _receiveVectors[BATCH_SIZE];
+    sockaddr_in         _receiveAddresses[BATCH_SIZE];
+    QVector<QByteArray> _receiveBuffers;
+    alignas(cmsghdr) char _receiveControl[BATCH_SIZE][CONTROL_SIZE];
+
+};
+
+#endif // BATCHTRANSFER_H
@@ -0,0 +1,123 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : biquaddesigner.cpp
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#include "biquaddesigner.h"
+#include <QtMath>
+
+BiquadDesigner::Coefficients BiquadDesigner::design(const Band &band, double sampleRate)
+{
+    Coefficients coefficients = {1.0, 0.0, 0.0, 0.0, 0.0};
+    double frequency = qBound(1.0, band.frequency, 0.49 * sampleRate);
+    if ((band.type == TYPE_BYPASS) || (band.q <= 0.0) || (sampleRate <= 0.0)) {
+        return coefficients;
+    }
+
+    // one sin and cos per band, cheap enough to redesign on every fader move
+    double w0 = 2.0 * M_PI * frequency / sampleRate;
+    double cosW0 = qCos(w0);
+    double alpha = qSin(w0) / (2.0 * band.q);
+    double a = qPow(10.0, band.gain / 40.0);
+
+    double b0 = 1.0;
+    double b1 = 0.0;
+    double b2 = 0.0;
+    double a0 = 1.0;
+    double a1 = 0.0;
+    double a2 = 0.0;
+    switch (band.type) {
+        case TYPE_PEAKING :
+            b0 = 1.0 + alpha*a;
+            b1 = -2.0 * cosW0;
+            b2 = 1.0 - alpha*a;
+            a0 = 1.0 + alpha/a;
+            a1 = -2.0 * cosW0;
+            a2 = 1.0 - alpha/a;
+            break;
+        case TYPE_LOW_SHELF : {
+            double beta = 2.0 * qSqrt(a) * alpha;
+            b0 = a * ((a+1.0) - (a-1.0)*cosW0 + beta);
+            b1 = 2.0 * a * ((a-1.0) - (a+1.0)*cosW0);
+            b2 = a * ((a+1.0) - (a-1.0)*cosW0 - beta);
+            a0 = (a+1.0) + (a-1.0)*cosW0 + beta;
+            a1 = -2.0 * ((a-1.0) + (a+1.0)*cosW0);
+            a2 = (a+1.0) + (a-1.0)*cosW0 - beta;
+            break;
+        }
+        case TYPE_HIGH_SHELF : {
+            double beta = 2.0 * qSqrt(a) * alpha;
+            b0 = a * ((a+1.0) + (a-1.0)*cosW0 + beta);
+            b1 = -2.0 * a * ((a-1.0) + (a+1.0)*cosW0);
+            b2 = a * ((a+1.0) + (a-1.0)*cosW0 - beta);
+            a0 = (a+1.0) - (a-1.0)*cosW0 + beta;
+            a1 = 2.0 * ((a-1.0) - (a+1.0)*cosW0);
+            a2 = (a+1.0) - (a-1.0)*cosW0 - beta;
+            break;
+        }
+        case TYPE_LOW_PASS :
+            b0 = (1.0 - cosW0) / 2.0;
+            b1 = 1.0 - cosW0;
+            b2 = (1.0 - cosW0) / 2.0;
+            a0 = 1.0 + alpha;
+            a1 = -2.0 * cosW0;
+            a2 = 1.0 - alpha;
+            break;
+        case TYPE_HIGH_PASS :
+            b0 = (1.0 + cosW0) / 2.0;
+            b1 = -(1.0 + cosW0);
+            b2 = (1.0 + cosW0) / 2.0;
+            a0 = 1.0 + alpha;
+            a1 = -2.0 * cosW0;
+            a2 = 1.0 - alpha;
+            break;
+        case TYPE_NOTCH :
+            b0 = 1.0;
+            b1 = -2.0 * cosW0;
+            b2 = 1.0;
+            a0 = 1.0 + alpha;
+            a1 = -2.0 * cosW0;
+            a2 = 1.0 - alpha;
+            break;
+        default :
+            break;
+    }
+
+    coefficients.b0 = b0 / a0;
+    coefficients.b1 = b1 / a0;
+    coefficients.b2 = b2 / a0;
+    coefficients.a1 = a1 / a0;
+    coefficients.a2 = a2 / a0;
+    return coefficients;
+}
+
+bool BiquadDesigner::quantize(const Coefficients &coefficients, quint32 *words)
+{
+    // the unused words of the section are written as zero so the whole
+    // section is one contiguous burst
+    for (int word=0; word<WORDS_PER_BIQUAD; word++) {
+        words[word] = 0;
+    }
+    bool clipped = false;
+    words[OFFSET_B0] = toFixed(coefficients.b0, clipped);
+    words[OFFSET_B1] = toFixed(coefficients.b1, clipped);
+    words[OFFSET_MINUS_A1] = toFixed(-coefficients.a1, clipped);
+    words[OFFSET_B2] = toFixed(coefficients.b2, clipped);
+    words[OFFSET_MINUS_A2] = toFixed(-coefficients.a2, clipped);
+    return !clipped;
+}
+
+quint32 BiquadDesigner::toFixed(double value, bool &clipped)
+{
+    // signed with 2 integer bits, range -4 to just below 4
+    const qint64 maxValue = (static_cast<qint64>(1) << (COEFFICIENT_BITS-1)) - 1;
+    const qint64 minValue = -(static_cast<qint64>(1) << (COEFFICIENT_BITS-1));
+    qint64 fixed = qRound64(value * (1 << FRACTION_BITS));
+    if ((fixed > maxValue) || (fixed < minValue)) {
+        clipped = true;
+        fixed = qBound(minValue, fixed, maxValue);
+    }
+    return static_cast<quint32>(fixed) & COEFFICIENT_MASK;
+}
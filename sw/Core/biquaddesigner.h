@@ -0,0 +1,64 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : biquaddesigner.h
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#ifndef BIQUADDESIGNER_H
+#define BIQUADDESIGNER_H
+
+#include <QtGlobal>
+
+// second order sections after the audio eq cookbook of r. bristow-johnson,
+// quantized to the coefficient memory layout of biquad.vhd
+class BiquadDesigner
+{
+
+public:
+    enum Type {
+        TYPE_BYPASS,
+        TYPE_PEAKING,
+        TYPE_LOW_SHELF,
+        TYPE_HIGH_SHELF,
+        TYPE_LOW_PASS,
+        TYPE_HIGH_PASS,
+        TYPE_NOTCH
+    };
+
+    struct Band {
+        Type   type;
+        double frequency;   // Hz
+        double gain;        // dB, peaking and shelf only
+        double q;
+    };
+
+    // normalized to a0 = 1
+    struct Coefficients {
+        double b0;
+        double b1;
+        double b2;
+        double a1;
+        double a2;
+    };
+
+    static Coefficients design(const Band &band, double sampleRate);
+    static bool         quantize(const Coefficients &coefficients, quint32 *words);
+
+    static const int     WORDS_PER_BIQUAD = 16;     // address_counter_r(3 downto 0)
+    static const int     COEFFICIENT_BITS = 27;     // DATA_W
+    static const int     FRACTION_BITS    = 24;
+    static const quint32 COEFFICIENT_MASK = (1u << COEFFICIENT_BITS) - 1;
+
+    // word offsets within a biquad, the feedback coefficients are stored negated
+    static const int OFFSET_B0       = 0;
+    static const int OFFSET_B1       = 6;
+    static const int OFFSET_MINUS_A1 = 7;
+    static const int OFFSET_B2       = 10;
+    static const int OFFSET_MINUS_A2 = 11;
+
+private:
+    static quint32 toFixed(double value, bool &clipped);
+};
+
+#endif // BIQUADDESIGNER_H
@@ -0,0 +1,119 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : biquaduploader.cpp
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#include "biquaduploader.h"
+#include "typedefinitions.h"
+
+BiquadUploader::BiquadUploader(IRegisterAccess *registerAccess, int biquadCount, double sampleRate, QObject *parent) :
+    QObject(parent),
+    _registerAccess(registerAccess),
+    _biquadCount(qBound(1, biquadCount, MAX_TRANSFER_WORDS / BiquadDesigner::WORDS_PER_BIQUAD)),
+    _channelStride(BiquadDesigner::WORDS_PER_BIQUAD),
+    _sampleRate(sampleRate)
+{
+    // coeff_addr_i is left & biquad_sel & offset, biquad_sel has log2ceil(NUMBER_OF_BIQUADS) bits
+    while (_channelStride < _biquadCount*BiquadDesigner::WORDS_PER_BIQUAD) {
+        _channelStride *= 2;
+    }
+
+    BiquadDesigner::Band bypass = {BiquadDesigner::TYPE_BYPASS, 1000.0, 0.0, 0.707};
+    for (int channel=0; channel<CHANNEL_COUNT; channel++) {
+        _channels[channel].words.fill(0, _biquadCount*BiquadDesigner::WORDS_PER_BIQUAD);
+        _channels[channel].clipped.fill(false, _biquadCount);
+        _channels[channel].pending = false;
+        _channels[channel].dirty = false;
+        for (int index=0; index<_biquadCount; index++) {
+            design(channel, index, bypass);
+        }
+    }
+}
+
+int BiquadUploader::getBiquadCount()
+{
+    return _biquadCount;
+}
+
+quint32 BiquadUploader::getChannelAddress(int channel)
+{
+    return COEFFICIENT_BASE + static_cast<quint32>(channel*_channelStride*REGISTER_SIZE);
+}
+
+bool BiquadUploader::isClipped(int channel)
+{
+    if ((channel < 0) || (channel >= CHANNEL_COUNT)) {
+        return false;
+    }
+    return _channels[channel].clipped.contains(true);
+}
+
+int BiquadUploader::setBand(int channel, int index, const BiquadDesigner::Band &band)
+{
+    if ((channel < 0) || (channel >= CHANNEL_COUNT) || (index < 0) || (index >= _biquadCount)) {
+        return AUDIO_ADDRESS_FORMAT_ERROR;
+    }
+    // only the moved band is designed again
+    design(channel, index, band);
+    return schedule(channel);
+}
+
+int BiquadUploader::setCurve(int channel, const QVector<BiquadDesigner::Band> &bands)
+{
+    if ((channel < 0) || (channel >= CHANNEL_COUNT) || (bands.length() > _biquadCount)) {
+        return AUDIO_LENGTH_ERROR;
+    }
+    // sections without a band are bypassed
+    BiquadDesigner::Band bypass = {BiquadDesigner::TYPE_BYPASS, 1000.0, 0.0, 0.707};
+    for (int index=0; index<_biquadCount; index++) {
+        design(channel, index, (index < bands.length()) ? bands[index] : bypass);
+    }
+    return schedule(channel);
+}
+
+void BiquadUploader::invalidate()
+{
+    // e.g. after the board restarted, the curve is written again
+    for (int channel=0; channel<CHANNEL_COUNT; channel++) {
+        schedule(channel);
+    }
+}
+
+void BiquadUploader::design(int channel, int index, const BiquadDesigner::Band &band)
+{
+    BiquadDesigner::Coefficients coefficients = BiquadDesigner::design(band, _sampleRate);
+    quint32 *words = _channels[channel].words.data() + index*BiquadDesigner::WORDS_PER_BIQUAD;
+    _channels[channel].clipped[index] = !BiquadDesigner::quantize(coefficients, words);
+}
+
+int BiquadUploader::schedule(int channel)
+{
+    Channel &entry = _channels[channel];
+    if (entry.pending) {
+        // the queued write is superseded as soon as it is out
+        entry.dirty = true;
+        return AUDIO_SUCCESS;
+    }
+    return send(channel);
+}
+
+int BiquadUploader::send(int channel)
+{
+    Channel &entry = _channels[channel];
+    entry.pending = true;
+    entry.dirty = false;
+    int error = _registerAccess->writeAsync(getChannelAddress(channel), entry.words, [this, channel](int writeError) {
+        Channel &done = _channels[channel];
+        done.pending = false;
+        emit uploaded(channel, writeError);
+        if (done.dirty) {
+            send(channel);
+        }
+    });
+    if (error != AUDIO_SUCCESS) {
+        entry.pending = false;
+    }
+    return error;
+}
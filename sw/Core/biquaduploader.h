@@ -0,0 +1,62 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : biquaduploader.h
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#ifndef BIQUADUPLOADER_H
+#define BIQUADUPLOADER_H
+
+#include <QObject>
+#include <QVector>
+#include "iregisteraccess.h"
+#include "biquaddesigner.h"
+
+// keeps the eq curve of the biquad cascade and writes it to the board
+//
+// a channel is written as one burst of all its sections. while a write is
+// queued further changes only update the curve, the latest one is sent
+// when the link is free again, so fast fader moves do not pile up
+class BiquadUploader : public QObject
+{
+    Q_OBJECT
+
+public:
+    static const int     CHANNEL_RIGHT    = 0;      // left_r is the msb of the coefficient address
+    static const int     CHANNEL_LEFT     = 1;
+    static const int     CHANNEL_COUNT    = 2;
+    static const quint32 COEFFICIENT_BASE = 0x4000;
+
+    BiquadUploader(IRegisterAccess *registerAccess, int biquadCount, double sampleRate, QObject *parent = nullptr);
+
+    int     setBand(int channel, int index, const BiquadDesigner::Band &band);
+    int     setCurve(int channel, const QVector<BiquadDesigner::Band> &bands);
+    void    invalidate();
+    int     getBiquadCount();
+    quint32 getChannelAddress(int channel);
+    bool    isClipped(int channel);
+
+signals:
+    void uploaded(int channel, int error);
+
+private:
+    struct Channel {
+        QVector<quint32> words;     // all sections in memory layout
+        QVector<bool>    clipped;
+        bool             pending;   // write queued in the register access
+        bool             dirty;     // changed since the queued write
+    };
+
+    void design(int channel, int index, const BiquadDesigner::Band &band);
+    int  schedule(int channel);
+    int  send(int channel);
+
+    IRegisterAccess  *_registerAccess;
+    int              _biquadCount;
+    int              _channelStride;    // words, sections are padded to a power of two
+    double           _sampleRate;
+    Channel          _channels[CHANNEL_COUNT];
+};
+
+#endif // BIQUADUPLOADER_H
@@ -0,0 +1,219 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : boardscanner.cpp
+// Changelog : 17.10.2026 - file created
+//             17.10.2026 - any datagram transport
+//------------------------------------------------------------------------------
+
+#include <QNetworkInterface>
+#include <algorithm>
+#include "boardscanner.h"
+#include "registermap.h"
+#include "typedefinitions.h"
+
+BoardScanner::BoardScanner(DatagramTransfer &transfer, QObject *parent) :
+    QObject(parent),
+    _transfer(transfer),
+    _timer(this),
+    _datagram(PacketCodec::MAX_PACKET_SIZE, 0),
+    _next(0),
+    _attempt(0),
+    _lastSendNs(0),
+    _running(false)
+{
+    // one burst per tick, the responses are served in between
+    _timer.setTimerType(Qt::PreciseTimer);
+    _timer.setInterval(1);
+    connect(&_timer, SIGNAL(timeout()), this, SLOT(onTimer()));
+    connect(&_transfer, SIGNAL(unknownPacketReceived(quint32,const char*,int)),
+            this, SLOT(onPacket(quint32,const char*,int)));
+}
+
+int BoardScanner::start()
+{
+    // number of hosts scanned, 0 if a scan is running or there is no subnet
+    if (_running) {
+        return 0;
+    }
+    _hosts.clear();
+    _hostIndex.clear();
+    _results.clear();
+    foreach (const QNetworkInterface &networkInterface, QNetworkInterface::allInterfaces()) {
+        QNetworkInterface::InterfaceFlags flags = networkInterface.flags();
+        if (!(flags & QNetworkInterface::IsUp) || !(flags & QNetworkInterface::IsRunning) ||
+            (flags & QNetworkInterface::IsLoopBack)) {
+            continue;
+        }
+        foreach (const QNetworkAddressEntry &entry, networkInterface.addressEntries()) {
+            if (entry.ip().protocol() == QAbstractSocket::IPv4Protocol) {
+                addSubnet(entry.ip().toIPv4Address(), entry.prefixLength());
+            }
+        }
+    }
+    if (_hosts.isEmpty()) {
+        closeSockets();
+        return 0;
+    }
+
+    _next = 0;
+    _attempt = 0;
+    _running = true;
+    _clock.start();
+    _lastSendNs = 0;
+    _timer.start();
+    onTimer();
+    return _hosts.length();
+}
+
+bool BoardScanner::isRunning()
+{
+    return _running;
+}
+
+const QVector<BoardScanner::Result> &BoardScanner::getResults()
+{
+    return _results;
+}
+
+void BoardScanner::addSubnet(quint32 localAddress, int prefixLength)
+{
+    // point to point links have no hosts to scan, large subnets would take
+    // too long and are reduced to the /24 of the interface
+    if ((prefixLength <= 0) || (prefixLength > MAX_PREFIX_LENGTH)) {
+        return;
+    }
+    if (prefixLength < MIN_PREFIX_LENGTH) {
+        prefixLength = 24;
+    }
+    quint32 mask = 0xffffffffu << (32 - prefixLength);
+    quint32 network = localAddress & mask;
+    quint32 broadcast = network | ~mask;
+
+    // the socket of the transport only receives on the address it is bound to
+    int socket = -1;
+    QHostAddress boundAddress = _transfer.getHostAddress();
+    if (!boundAddress.isNull() && (boundAddress.toIPv4Address() != localAddress)) {
+        QUdpSocket *udpSocket = new QUdpSocket(this);
+        if (!udpSocket->bind(QHostAddress(localAddress), _transfer.getPort())) {
+            delete udpSocket;
+            return;
+        }
+        connect(udpSocket, SIGNAL(readyRead()), this, SLOT(onSocketReadyRead()));
+        socket = _sockets.length();
+        _sockets.append(udpSocket);
+    }
+
+    for (quint32 address=network+1; address<broadcast; address++) {
+        if ((address == localAddress) || _hostIndex.contains(address) || (_transfer.findPeer(address) >= 0)) {
+            continue;
+        }
+        Host host;
+        host.address = address;
+        host.socket = socket;
+        host.answered = false;
+        host.sentNs = 0;
+        _hostIndex.insert(address, _hosts.length());
+        _hosts.append(host);
+    }
+}
+
+void BoardScanner::onTimer()
+{
+    if (_next < _hosts.length()) {
+        int count = 0;
+        while ((_next < _hosts.length()) && (count < BURST_SIZE)) {
+            if (!_hosts[_next].answered) {
+                send(_next);
+                count++;
+            }
+            _next++;
+        }
+        return;
+    }
+
+    // the round is done once the last read had the time to be answered
+    if ((_clock.nsecsElapsed() - _lastSendNs) < static_cast<qint64>(WAIT_TIME) * 1000000) {
+        return;
+    }
+    _attempt++;
+    if ((_attempt >= MAX_ATTEMPTS) || (_results.length() == _hosts.length())) {
+        finish();
+        return;
+    }
+    _next = 0;
+}
+
+void BoardScanner::send(int index)
+{
+    // the id only tells 256 hosts apart, the sender address does the rest
+    Host &host = _hosts[index];
+    int size = PacketCodec::encodeRead(_sendBuffer, static_cast<quint8>(index), RegisterMap::Version::address(), 1);
+    host.sentNs = _clock.nsecsElapsed();
+    _lastSendNs = host.sentNs;
+    if (host.socket < 0) {
+        _transfer.sendPacketTo(host.address, _sendBuffer, size);
+    } else {
+        _sockets[host.socket]->writeDatagram(_sendBuffer, size, QHostAddress(host.address), _transfer.getPort());
+    }
+}
+
+void BoardScanner::onPacket(quint32 sender, const char *data, int size)
+{
+    if (!_running) {
+        return;
+    }
+    int index = _hostIndex.value(sender, -1);
+    if (index < 0) {
+        return;
+    }
+    Host &host = _hosts[index];
+    quint32 version = 0;
+    if (host.answered || (PacketCodec::getId(data) != static_cast<quint8>(index)) ||
+        (PacketCodec::decodeReadResponse(data, size, &version, 1) != AUDIO_SUCCESS)) {
+        return;
+    }
+    host.answered = true;
+
+    // a response to the second read may belong to the first one as well
+    Result result;
+    result.address = QHostAddress(sender).toString();
+    result.version = version;
+    result.roundTripTime = static_cast<quint32>((_clock.nsecsElapsed() - host.sentNs) / 1000);
+    _results.append(result);
+}
+
+void BoardScanner::onSocketReadyRead()
+{
+    QUdpSocket *socket = qobject_cast<QUdpSocket *>(QObject::sender());
+    if (socket == nullptr) {
+        return;
+    }
+    QHostAddress address;
+    while (socket->hasPendingDatagrams()) {
+        qint64 size = socket->readDatagram(_datagram.data(), _datagram.size(), &address);
+        if (size > 0) {
+            onPacket(address.toIPv4Address(), _datagram.constData(), static_cast<int>(size));
+        }
+    }
+}
+
+void BoardScanner::finish()
+{
+    _timer.stop();
+    _running = false;
+    closeSockets();
+
+    std::sort(_results.begin(), _results.end(), [](const Result &first, const Result &second) {
+        return QHostAddress(first.address).toIPv4Address() < QHostAddress(second.address).toIPv4Address();
+    });
+    emit finished();
+}
+
+void BoardScanner::closeSockets()
+{
+    foreach (QUdpSocket *socket, _sockets) {
+        delete socket;
+    }
+    _sockets.clear();
+}
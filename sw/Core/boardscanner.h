@@ -0,0 +1,91 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : boardscanner.h
+// Changelog : 17.10.2026 - file created
+//             17.10.2026 - any datagram transport
+//------------------------------------------------------------------------------
+
+#ifndef BOARDSCANNER_H
+#define BOARDSCANNER_H
+
+#include <QObject>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QVector>
+#include <QHash>
+#include <QUdpSocket>
+
+#include "datagramtransfer.h"
+#include "packetcodec.h"
+
+// finds boards in the attached subnets by reading their version register,
+// lives in the I/O thread of ControlLink
+//
+// the reads of all hosts are sent in bursts without waiting for responses,
+// hosts that did not answer get a second read once the first round is
+// done. the subnet of the link is served by the socket of the transport
+// as the boards answer to the control port, other subnets by a socket bound
+// to the address of the interface. boards that are already peers are
+// skipped, their requests share the packet ids
+class BoardScanner : public QObject
+{
+    Q_OBJECT
+
+public:
+    struct Result {
+        QString address;
+        quint32 version;
+        quint32 roundTripTime;   // in us
+    };
+
+    static const int MAX_ATTEMPTS      = 2;
+    static const int BURST_SIZE        = 64;    // reads per timer tick
+    static const int WAIT_TIME         = 150;   // ms after the last read of a round
+    static const int MIN_PREFIX_LENGTH = 20;    // larger subnets are scanned as /24
+    static const int MAX_PREFIX_LENGTH = 30;
+
+    explicit BoardScanner(DatagramTransfer &transfer, QObject *parent = nullptr);
+
+    int                    start();
+    bool                   isRunning();
+    const QVector<Result> &getResults();
+
+signals:
+    void finished();
+
+private slots:
+    void onTimer();
+    void onPacket(quint32 sender, const char *data, int size);
+    void onSocketReadyRead();
+
+private:
+    struct Host {
+        quint32 address;
+        int     socket;     // index into _sockets, -1 for the transport
+        bool    answered;
+        qint64  sentNs;
+    };
+
+    void addSubnet(quint32 localAddress, int prefixLength);
+    void send(int index);
+    void finish();
+    void closeSockets();
+
+    DatagramTransfer      &_transfer;
+    QTimer                _timer;
+    QElapsedTimer         _clock;
+    QVector<Host>         _hosts;
+    QHash<quint32, int>   _hostIndex;
+    QVector<QUdpSocket *> _sockets;
+    QVector<Result>       _results;
+    QByteArray            _datagram;
+    char                  _sendBuffer[PacketCodec::REQUEST_HEADER_SIZE];
+    int                   _next;
+    int                   _attempt;
+    qint64                _lastSendNs;
+    bool                  _running;
+
+};
+
+#endif // BOARDSCANNER_H
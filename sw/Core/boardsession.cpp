@@ -0,0 +1,108 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : boardsession.cpp
+// Changelog : 17.10.2026 - file created
+//             17.10.2026 - read data passed in place
+//             18.10.2026 - blocking read for the command line tools only
+//------------------------------------------------------------------------------
+
+#include "boardsession.h"
+#include "typedefinitions.h"
+
+BoardSession::BoardSession(ControlLink &controlLink, int board, QString address, QObject *parent) :
+    QObject(parent),
+    _controlLink(controlLink),
+    _board(board),
+    _address(address),
+    _updater(this, this)
+{
+    // the DeviceManager drives all sessions from one timer
+    _updater.setInterval(0);
+}
+
+BoardSession::~BoardSession() {}
+
+int BoardSession::read(quint32 address, QVector<quint32> &data, int length)
+{
+    // the GUI uses readAsync(), it must not wait for the link
+    if (!_controlLink.isBlockingAllowed()) {
+        return AUDIO_BLOCKING_ERROR;
+    }
+
+    int errorCode = AUDIO_TIMEOUT_ERROR;
+    bool done = false;
+    int requestError = readAsync(address, length, [&](int error, const quint32 *readData, int readLength) {
+        errorCode = error;
+        for (int word=0; word<readLength; word++) {
+            data.append(readData[word]);
+        }
+        done = true;
+    });
+    if (requestError != AUDIO_SUCCESS) {
+        return requestError;
+    }
+
+    // the I/O thread answers every request, at the latest with a timeout
+    while (!done) {
+        poll(1);
+    }
+    return errorCode;
+}
+
+int BoardSession::write(quint32 address, QVector<quint32> &data)
+{
+    return writeAsync(address, data, nullptr);
+}
+
+int BoardSession::readAsync(quint32 address, int length, ReadCallback callback)
+{
+    return _controlLink.readAsync(_board, address, length, callback);
+}
+
+int BoardSession::writeAsync(quint32 address, const QVector<quint32> &data, WriteCallback callback)
+{
+    return _controlLink.writeAsync(_board, address, data, callback);
+}
+
+void BoardSession::poll(int waitMs)
+{
+    // results of all boards arrive on the same queue
+    _controlLink.poll(waitMs);
+}
+
+int BoardSession::getBoard()
+{
+    return _board;
+}
+
+QString BoardSession::getAddress()
+{
+    return _address;
+}
+
+bool BoardSession::setAddress(QString address)
+{
+    bool changed = _controlLink.setBoardAddress(_board, address);
+    if (_address != address) {
+        _address = address;
+        // a different board does not know our values yet
+        _updater.invalidateShadow();
+    }
+    return changed;
+}
+
+Updater &BoardSession::getUpdater()
+{
+    return _updater;
+}
+
+void BoardSession::getHealth(ControlLink::BoardHealth &health)
+{
+    _controlLink.getHealth(_board, health);
+}
+
+void BoardSession::update()
+{
+    _updater.update();
+}
@@ -0,0 +1,47 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : boardsession.h
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#ifndef BOARDSESSION_H
+#define BOARDSESSION_H
+
+#include <QObject>
+
+#include "iregisteraccess.h"
+#include "controllink.h"
+#include "updater.h"
+
+// register access and updater of one board behind a shared ControlLink
+class BoardSession : public QObject, public IRegisterAccess
+{
+    Q_OBJECT
+
+public:
+    BoardSession(ControlLink &controlLink, int board, QString address, QObject *parent = nullptr);
+    ~BoardSession() override;
+
+    int  read(quint32 address, QVector<quint32> &data, int length) override;
+    int  write(quint32 address, QVector<quint32> &data) override;
+    int  readAsync(quint32 address, int length, ReadCallback callback) override;
+    int  writeAsync(quint32 address, const QVector<quint32> &data, WriteCallback callback) override;
+    void poll(int waitMs) override;
+
+    int      getBoard();
+    QString  getAddress();
+    bool     setAddress(QString address);
+    Updater &getUpdater();
+    void     getHealth(ControlLink::BoardHealth &health);
+    void     update();
+
+private:
+    ControlLink &_controlLink;
+    int         _board;
+    QString     _address;
+    Updater     _updater;
+
+};
+
+#endif // BOARDSESSION_H
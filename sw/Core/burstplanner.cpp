@@ -0,0 +1,80 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : burstplanner.cpp
+// Changelog : 17.10.2026 - file created
+//             17.10.2026 - gap filter added
+//------------------------------------------------------------------------------
+
+#include <algorithm>
+#include "burstplanner.h"
+#include "typedefinitions.h"
+
+BurstPlanner::BurstPlanner(int maxGap, int maxLength) :
+    _maxGap(maxGap),
+    _maxLength(maxLength),
+    _gapFilter(nullptr)
+{
+
+}
+
+void BurstPlanner::setGapFilter(GapFilter filter)
+{
+    _gapFilter = filter;
+}
+
+void BurstPlanner::clear()
+{
+    _registers.clear();
+}
+
+void BurstPlanner::addRegister(quint32 address, int element)
+{
+    Register reg;
+    reg.address = address;
+    reg.element = element;
+    _registers.append(reg);
+}
+
+QVector<BurstPlanner::Burst> BurstPlanner::plan()
+{
+    QVector<Register> sorted(_registers);
+    std::stable_sort(sorted.begin(), sorted.end(), [](const Register &a, const Register &b) {
+        return a.address < b.address;
+    });
+
+    QVector<Burst> bursts;
+    foreach (const Register &reg, sorted) {
+        if (!bursts.isEmpty()) {
+            Burst &burst = bursts.last();
+            quint32 distance = reg.address - burst.address;
+            int offset = static_cast<int>(distance / REGISTER_SIZE);
+            // gap words in between are transferred as well
+            bool aligned = (distance % REGISTER_SIZE) == 0;
+            bool closeEnough = offset <= (burst.length + _maxGap);
+            bool fits = offset < _maxLength;
+            bool gapAllowed = true;
+            for (int gap=burst.length; (gap<offset) && gapAllowed && (_gapFilter != nullptr); gap++) {
+                gapAllowed = _gapFilter(burst.address + static_cast<quint32>(gap*REGISTER_SIZE));
+            }
+            if (aligned && closeEnough && fits && gapAllowed) {
+                Target target;
+                target.offset = offset;
+                target.element = reg.element;
+                burst.targets.append(target);
+                burst.length = qMax(burst.length, offset + 1);
+                continue;
+            }
+        }
+        Burst burst;
+        burst.address = reg.address;
+        burst.length = 1;
+        Target target;
+        target.offset = 0;
+        target.element = reg.element;
+        burst.targets.append(target);
+        bursts.append(burst);
+    }
+
+    return bursts;
+}
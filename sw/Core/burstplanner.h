@@ -0,0 +1,52 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : burstplanner.h
+// Changelog : 17.10.2026 - file created
+//             17.10.2026 - gap filter added
+//------------------------------------------------------------------------------
+
+#ifndef BURSTPLANNER_H
+#define BURSTPLANNER_H
+
+#include <QVector>
+
+// merges register addresses into as few burst transfers as possible
+class BurstPlanner
+{
+
+public:
+    struct Target {
+        int offset;   // word offset inside the burst
+        int element;  // index given to addRegister()
+    };
+
+    struct Burst {
+        quint32         address;
+        int             length;
+        QVector<Target> targets;
+    };
+
+    // true if the word at the address may be transferred as gap
+    typedef bool (*GapFilter)(quint32 address);
+
+    BurstPlanner(int maxGap, int maxLength);
+    void           setGapFilter(GapFilter filter);
+    void           clear();
+    void           addRegister(quint32 address, int element);
+    QVector<Burst> plan();
+
+private:
+    struct Register {
+        quint32 address;
+        int     element;
+    };
+
+    int               _maxGap;
+    int               _maxLength;
+    GapFilter         _gapFilter;
+    QVector<Register> _registers;
+
+};
+
+#endif // BURSTPLANNER_H
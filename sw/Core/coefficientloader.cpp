@@ -0,0 +1,218 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : coefficientloader.cpp
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#include "coefficientloader.h"
+
+CoefficientLoader::CoefficientLoader(IRegisterAccess *registerAccess, QObject *parent) :
+    QObject(parent),
+    _registerAccess(registerAccess),
+    _state(STATE_IDLE),
+    _generation(0),
+    _activeBank(0),
+    _targetBank(1),
+    _attempt(0),
+    _maxAttempts(2),
+    _outstanding(0),
+    _done(0),
+    _mismatches(0),
+    _burst(MAX_BURST_WORDS),
+    _loadTime(0)
+{
+}
+
+quint32 CoefficientLoader::getCoefficientAddress(int bank, int channel)
+{
+    return COEFFICIENT_BASE + static_cast<quint32>((bank*CHANNEL_COUNT + channel) * TAP_COUNT * REGISTER_SIZE);
+}
+
+int CoefficientLoader::load(const quint32 *left, const quint32 *right)
+{
+    if (_state != STATE_IDLE) {
+        return AUDIO_BUSY_ERROR;
+    }
+    for (int tap=0; tap<TAP_COUNT; tap++) {
+        _coefficients[0][tap] = left[tap] & COEFFICIENT_MASK;
+        _coefficients[1][tap] = right[tap] & COEFFICIENT_MASK;
+    }
+    _generation++;
+    _attempt = 0;
+    _done = 0;
+    _timer.start();
+    readBankSelect();
+    return AUDIO_SUCCESS;
+}
+
+bool CoefficientLoader::isBusy()
+{
+    return _state != STATE_IDLE;
+}
+
+int CoefficientLoader::getActiveBank()
+{
+    return _activeBank;
+}
+
+qint64 CoefficientLoader::getLoadTime()
+{
+    // duration of the last load in ms
+    return _loadTime;
+}
+
+void CoefficientLoader::setMaxAttempts(int attempts)
+{
+    _maxAttempts = qMax(1, attempts);
+}
+
+int CoefficientLoader::getTotalSteps()
+{
+    // every burst is written and read back once per attempt
+    return 2 * CHANNEL_COUNT * BURSTS_PER_CHANNEL;
+}
+
+void CoefficientLoader::readBankSelect()
+{
+    // the board may have been switched by someone else, ask for the bank
+    _state = STATE_SELECT;
+    int generation = _generation;
+    int error = _registerAccess->readAsync(BANK_SELECT_ADDRESS, 1, [this, generation](int readError, const quint32 *data, int length) {
+        if ((generation != _generation) || (_state != STATE_SELECT)) {
+            return;
+        }
+        if ((readError != AUDIO_SUCCESS) || (length < 1)) {
+            finish((readError != AUDIO_SUCCESS) ? readError : AUDIO_RECEIVED_LENGTH_ERROR);
+            return;
+        }
+        _activeBank = static_cast<int>(data[0] & 1);
+        _targetBank = 1 - _activeBank;
+        writeBank();
+    });
+    if (error != AUDIO_SUCCESS) {
+        finish(error);
+    }
+}
+
+void CoefficientLoader::writeBank()
+{
+    _state = STATE_WRITE;
+    _attempt++;
+    _done = 0;
+    _outstanding = CHANNEL_COUNT * BURSTS_PER_CHANNEL;
+    int generation = _generation;
+
+    // all bursts are queued at once, the window of the register access
+    // keeps the link busy without flooding the board
+    for (int channel=0; channel<CHANNEL_COUNT; channel++) {
+        quint32 address = getCoefficientAddress(_targetBank, channel);
+        for (int burst=0; burst<BURSTS_PER_CHANNEL; burst++) {
+            for (int word=0; word<MAX_BURST_WORDS; word++) {
+                _burst[word] = _coefficients[channel][burst*MAX_BURST_WORDS + word];
+            }
+            int error = _registerAccess->writeAsync(address + static_cast<quint32>(burst*MAX_BURST_WORDS*REGISTER_SIZE), _burst,
+                                                    [this, generation](int writeError) {
+                if ((generation != _generation) || (_state != STATE_WRITE)) {
+                    return;
+                }
+                if (writeError != AUDIO_SUCCESS) {
+                    finish(writeError);
+                    return;
+                }
+                emit progress(++_done, getTotalSteps());
+                if (--_outstanding == 0) {
+                    verifyBank();
+                }
+            });
+            if (error != AUDIO_SUCCESS) {
+                finish(error);
+                return;
+            }
+        }
+    }
+}
+
+void CoefficientLoader::verifyBank()
+{
+    // writes are not acknowledged by eth_ctrl, the read back is the only
+    // proof that the coefficients arrived
+    _state = STATE_VERIFY;
+    _mismatches = 0;
+    _outstanding = CHANNEL_COUNT * BURSTS_PER_CHANNEL;
+    int generation = _generation;
+
+    for (int channel=0; channel<CHANNEL_COUNT; channel++) {
+        quint32 address = getCoefficientAddress(_targetBank, channel);
+        for (int burst=0; burst<BURSTS_PER_CHANNEL; burst++) {
+            // the capture stays small enough for the std::function buffer
+            qint16 channelIndex = static_cast<qint16>(channel);
+            qint16 first = static_cast<qint16>(burst*MAX_BURST_WORDS);
+            int error = _registerAccess->readAsync(address + static_cast<quint32>(first*REGISTER_SIZE), MAX_BURST_WORDS,
+                                                   [this, generation, channelIndex, first](int readError, const quint32 *data, int length) {
+                if ((generation != _generation) || (_state != STATE_VERIFY)) {
+                    return;
+                }
+                if (readError != AUDIO_SUCCESS) {
+                    finish(readError);
+                    return;
+                }
+                if (length < MAX_BURST_WORDS) {
+                    _mismatches++;
+                } else {
+                    for (int word=0; word<MAX_BURST_WORDS; word++) {
+                        if ((data[word] & COEFFICIENT_MASK) != _coefficients[channelIndex][first+word]) {
+                            _mismatches++;
+                            break;
+                        }
+                    }
+                }
+                emit progress(++_done, getTotalSteps());
+                if (--_outstanding > 0) {
+                    return;
+                }
+                if (_mismatches == 0) {
+                    swapBank();
+                } else if (_attempt < _maxAttempts) {
+                    writeBank();
+                } else {
+                    finish(AUDIO_VERIFY_ERROR);
+                }
+            });
+            if (error != AUDIO_SUCCESS) {
+                finish(error);
+                return;
+            }
+        }
+    }
+}
+
+void CoefficientLoader::swapBank()
+{
+    _state = STATE_SWAP;
+    int generation = _generation;
+    _burst.resize(1);
+    _burst[0] = static_cast<quint32>(_targetBank);
+    int error = _registerAccess->writeAsync(BANK_SELECT_ADDRESS, _burst, [this, generation](int writeError) {
+        if ((generation != _generation) || (_state != STATE_SWAP)) {
+            return;
+        }
+        if (writeError == AUDIO_SUCCESS) {
+            _activeBank = _targetBank;
+        }
+        finish(writeError);
+    });
+    _burst.resize(MAX_BURST_WORDS);
+    if (error != AUDIO_SUCCESS) {
+        finish(error);
+    }
+}
+
+void CoefficientLoader::finish(int error)
+{
+    // late callbacks of this load see another generation
+    _generation++;
+    _state = STATE_IDLE;
+    _loadTime = _timer.elapsed();
+    emit finished(error);
+}
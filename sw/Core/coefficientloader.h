@@ -0,0 +1,84 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : coefficientloader.h
+// Changelog : 17.10.2026 - file created
+//             17.10.2026 - bank select from the register map
+//------------------------------------------------------------------------------
+
+#ifndef COEFFICIENTLOADER_H
+#define COEFFICIENTLOADER_H
+
+#include <QObject>
+#include <QVector>
+#include <QElapsedTimer>
+#include "iregisteraccess.h"
+#include "typedefinitions.h"
+#include "registermap.h"
+
+// uploads the fir coefficients of the convolution engine
+//
+// the coefficients are written to the bank that is not playing, read back
+// and compared, and only then the bank select register is switched, so
+// the audio never runs with half a response
+class CoefficientLoader : public QObject
+{
+    Q_OBJECT
+
+public:
+    static const int     TAP_COUNT           = 512;     // coefficient ram of convolution.vhd
+    static const int     CHANNEL_COUNT       = 2;
+    static const int     BANK_COUNT          = 2;
+    static const quint32 BANK_SELECT_ADDRESS = RegisterMap::FirBankSelect::address();
+    static const quint32 COEFFICIENT_BASE    = 0x1000;  // bank 0 left, right, bank 1 left, right
+    static const quint32 COEFFICIENT_MASK    = 0x00ffffff;
+
+    explicit CoefficientLoader(IRegisterAccess *registerAccess, QObject *parent = nullptr);
+
+    int     load(const quint32 *left, const quint32 *right);
+    bool    isBusy();
+    int     getActiveBank();
+    qint64  getLoadTime();
+    void    setMaxAttempts(int attempts);
+
+    static quint32 getCoefficientAddress(int bank, int channel);
+
+signals:
+    void progress(int done, int total);
+    void finished(int error);
+
+private:
+    enum State {
+        STATE_IDLE,
+        STATE_SELECT,
+        STATE_WRITE,
+        STATE_VERIFY,
+        STATE_SWAP
+    };
+
+    static const int BURSTS_PER_CHANNEL = TAP_COUNT / MAX_BURST_WORDS;
+
+    void  readBankSelect();
+    void  writeBank();
+    void  verifyBank();
+    void  swapBank();
+    void  finish(int error);
+    int   getTotalSteps();
+
+    IRegisterAccess  *_registerAccess;
+    State            _state;
+    int              _generation;     // callbacks of an aborted load are ignored
+    int              _activeBank;
+    int              _targetBank;
+    int              _attempt;
+    int              _maxAttempts;
+    int              _outstanding;
+    int              _done;
+    int              _mismatches;
+    quint32          _coefficients[CHANNEL_COUNT][TAP_COUNT];
+    QVector<quint32> _burst;
+    QElapsedTimer    _timer;
+    qint64           _loadTime;
+};
+
+#endif // COEFFICIENTLOADER_H
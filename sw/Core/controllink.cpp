@@ -0,0 +1,331 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : controllink.cpp
+// Changelog : 17.10.2026 - file created
+//             17.10.2026 - multiple boards
+//             17.10.2026 - request data inline
+//             17.10.2026 - retransmission statistics
+//             17.10.2026 - scheduled writes
+//             17.10.2026 - link metrics
+//             17.10.2026 - board scan
+//             17.10.2026 - batched linux transport
+//             18.10.2026 - blocking calls for the command line tools only
+//             18.10.2026 - next free callback slot taken
+//------------------------------------------------------------------------------
+
+#include "controllink.h"
+#include "typedefinitions.h"
+
+ControlLink::ControlLink(LinkTransport transport, QObject *parent) :
+    QObject(parent),
+    _thread(this),
+    // the queues hold the data inline, too large for the stack
+    _requestQueue(new LinkRequestQueue()),
+    _resultQueue(new LinkResultQueue()),
+    _schedule(new LinkSchedule()),
+    _metrics(new LinkMetrics()),
+    _scan(new LinkScan()),
+    _wakePending(false),
+    _worker(new LinkWorker(*_requestQueue, *_resultQueue, *_schedule, _wakePending, _statistics, *_metrics, *_scan, transport)),
+    _tag(0),
+    _blockingAllowed(false)
+{
+    for (int board=0; board<LINK_MAX_BOARDS; board++) {
+        _statistics[board].requests.store(0);
+        _statistics[board].responses.store(0);
+        _statistics[board].timeouts.store(0);
+        _statistics[board].latePackets.store(0);
+        _statistics[board].roundTripTime.store(0);
+        _statistics[board].timeout.store(0);
+        _statistics[board].retransmits.store(0);
+        _statistics[board].pending.store(0);
+        _statistics[board].orphanedPackets.store(0);
+        _statistics[board].formatErrors.store(0);
+        _statistics[board].sentBytes.store(0);
+        _statistics[board].receivedBytes.store(0);
+    }
+    for (unsigned int index=0; index<LINK_QUEUE_SIZE; index++) {
+        _pending[index].active = false;
+    }
+    _schedule->errors.store(0);
+    _metrics->unknownPackets.store(0);
+    _metrics->droppedPackets.store(0);
+    _metrics->receiveBacklog.store(0);
+    for (int error=0; error<AUDIO_ERROR_COUNT; error++) {
+        _errorCounts[error] = 0;
+    }
+
+    _worker->moveToThread(&_thread);
+    connect(&_thread, SIGNAL(started()), _worker, SLOT(start()));
+    connect(&_thread, SIGNAL(finished()), _worker, SLOT(deleteLater()));
+    connect(_worker, SIGNAL(scanFinished()), this, SIGNAL(scanFinished()));
+    _thread.setObjectName("ControlLink");
+    _thread.start();
+}
+
+ControlLink::~ControlLink()
+{
+    // the batch loop of the worker ends on the interruption
+    _thread.requestInterruption();
+    _worker->wake();
+    _thread.quit();
+    _thread.wait();
+    delete _requestQueue;
+    delete _resultQueue;
+    delete _schedule;
+    delete _metrics;
+    delete _scan;
+}
+
+int ControlLink::readAsync(int board, quint32 address, int length, IRegisterAccess::ReadCallback callback)
+{
+    if (length > MAX_TRANSFER_WORDS) {
+        return AUDIO_LENGTH_ERROR;
+    }
+    _request.board = board;
+    _request.read = true;
+    _request.address = address;
+    _request.length = length;
+    return submit(callback, nullptr);
+}
+
+int ControlLink::writeAsync(int board, quint32 address, const QVector<quint32> &data, IRegisterAccess::WriteCallback callback)
+{
+    if (data.length() > MAX_TRANSFER_WORDS) {
+        return AUDIO_LENGTH_ERROR;
+    }
+    _request.board = board;
+    _request.read = false;
+    _request.address = address;
+    _request.length = data.length();
+    for (int word=0; word<data.length(); word++) {
+        _request.data[word] = data[word];
+    }
+    return submit(nullptr, callback);
+}
+
+void ControlLink::poll(int waitMs)
+{
+    // the GUI thread never waits for the link, waitMs is ignored there
+    if (!processResults() && (waitMs > 0) && _blockingAllowed) {
+        QThread::msleep(static_cast<unsigned long>(waitMs));
+        processResults();
+    }
+}
+
+void ControlLink::setBlockingAllowed(bool allowed)
+{
+    // for command line tools that wait for their results, e.g. Control
+    _blockingAllowed = allowed;
+}
+
+bool ControlLink::isBlockingAllowed()
+{
+    return _blockingAllowed;
+}
+
+int ControlLink::scheduleWrite(int board, quint32 address, const quint32 *data, int length, qint64 deadline)
+{
+    // called by one scheduler thread, the GUI thread keeps writeAsync()
+    if (length > MAX_TRANSFER_WORDS) {
+        return AUDIO_LENGTH_ERROR;
+    }
+    LinkRequest &request = _scheduleRequest;
+    request.tag = 0;
+    request.board = board;
+    request.read = false;
+    request.address = address;
+    request.length = length;
+    request.deadline = deadline;
+    for (int word=0; word<length; word++) {
+        request.data[word] = data[word];
+    }
+    if (!_schedule->queue.push(request)) {
+        return AUDIO_BUSY_ERROR;
+    }
+    if (!_wakePending.exchange(true)) {
+        _worker->wake();
+    }
+    return AUDIO_SUCCESS;
+}
+
+LatencyHistogram &ControlLink::getJitter()
+{
+    return _schedule->jitter;
+}
+
+quint32 ControlLink::getScheduleErrors()
+{
+    return _schedule->errors.load(std::memory_order_relaxed);
+}
+
+LatencyHistogram &ControlLink::getRoundTrip()
+{
+    // requests of all boards that were answered without retransmission
+    return _metrics->roundTrip;
+}
+
+quint32 ControlLink::getErrorCount(int error)
+{
+    // completed and rejected requests, AUDIO_SUCCESS included
+    if ((error < 0) || (error >= AUDIO_ERROR_COUNT)) {
+        return 0;
+    }
+    return _errorCounts[error];
+}
+
+QString ControlLink::getAddress()
+{
+    QString address;
+    QMetaObject::invokeMethod(_worker, "getAddress", Qt::BlockingQueuedConnection,
+                              Q_RETURN_ARG(QString, address));
+    return address;
+}
+
+quint16 ControlLink::getPort()
+{
+    quint16 port = 0;
+    QMetaObject::invokeMethod(_worker, "getPort", Qt::BlockingQueuedConnection,
+                              Q_RETURN_ARG(quint16, port));
+    return port;
+}
+
+bool ControlLink::setAddress(QString address)
+{
+    bool changed = false;
+    QMetaObject::invokeMethod(_worker, "setAddress", Qt::BlockingQueuedConnection,
+                              Q_RETURN_ARG(bool, changed), Q_ARG(QString, address));
+    return changed;
+}
+
+bool ControlLink::setPort(quint16 port)
+{
+    bool changed = false;
+    QMetaObject::invokeMethod(_worker, "setPort", Qt::BlockingQueuedConnection,
+                              Q_RETURN_ARG(bool, changed), Q_ARG(quint16, port));
+    return changed;
+}
+
+int ControlLink::addBoard(QString address)
+{
+    int board = -1;
+    QMetaObject::invokeMethod(_worker, "addBoard", Qt::BlockingQueuedConnection,
+                              Q_RETURN_ARG(int, board), Q_ARG(QString, address));
+    return board;
+}
+
+void ControlLink::removeBoard(int board)
+{
+    // outstanding requests of the board complete with AUDIO_BOARD_ERROR
+    QMetaObject::invokeMethod(_worker, "removeBoard", Qt::BlockingQueuedConnection,
+                              Q_ARG(int, board));
+}
+
+bool ControlLink::setBoardAddress(int board, QString address)
+{
+    bool changed = false;
+    QMetaObject::invokeMethod(_worker, "setBoardAddress", Qt::BlockingQueuedConnection,
+                              Q_RETURN_ARG(bool, changed), Q_ARG(int, board), Q_ARG(QString, address));
+    return changed;
+}
+
+void ControlLink::getHealth(int board, BoardHealth &health)
+{
+    if ((board < 0) || (board >= LINK_MAX_BOARDS)) {
+        health = BoardHealth();
+        return;
+    }
+    const LinkStatistics &statistics = _statistics[board];
+    health.requests = statistics.requests.load(std::memory_order_relaxed);
+    health.responses = statistics.responses.load(std::memory_order_relaxed);
+    health.timeouts = statistics.timeouts.load(std::memory_order_relaxed);
+    health.latePackets = statistics.latePackets.load(std::memory_order_relaxed);
+    health.roundTripTime = statistics.roundTripTime.load(std::memory_order_relaxed);
+    health.timeout = statistics.timeout.load(std::memory_order_relaxed);
+    health.retransmits = statistics.retransmits.load(std::memory_order_relaxed);
+    health.pending = statistics.pending.load(std::memory_order_relaxed);
+    health.orphanedPackets = statistics.orphanedPackets.load(std::memory_order_relaxed);
+    health.formatErrors = statistics.formatErrors.load(std::memory_order_relaxed);
+    health.sentBytes = statistics.sentBytes.load(std::memory_order_relaxed);
+    health.receivedBytes = statistics.receivedBytes.load(std::memory_order_relaxed);
+}
+
+void ControlLink::getLinkHealth(LinkHealth &health)
+{
+    health.unknownPackets = _metrics->unknownPackets.load(std::memory_order_relaxed);
+    health.droppedPackets = _metrics->droppedPackets.load(std::memory_order_relaxed);
+    health.receiveBacklog = _metrics->receiveBacklog.load(std::memory_order_relaxed);
+}
+
+bool ControlLink::startScan()
+{
+    // scanFinished() is emitted when the results are ready
+    bool started = false;
+    QMetaObject::invokeMethod(_worker, "startScan", Qt::BlockingQueuedConnection,
+                              Q_RETURN_ARG(bool, started));
+    return started;
+}
+
+void ControlLink::getScanResults(QVector<BoardScanner::Result> &results)
+{
+    _scan->mutex.lock();
+    results = _scan->results;
+    _scan->mutex.unlock();
+}
+
+int ControlLink::submit(IRegisterAccess::ReadCallback readCallback, IRegisterAccess::WriteCallback writeCallback)
+{
+    // the tag selects the callback slot, tags of busy slots are skipped. all
+    // slots busy means too many outstanding requests
+    for (unsigned int count=0; (count<LINK_QUEUE_SIZE) && _pending[_tag & (LINK_QUEUE_SIZE-1)].active; count++) {
+        _tag++;
+    }
+    Pending &pending = _pending[_tag & (LINK_QUEUE_SIZE-1)];
+    if (pending.active) {
+        _errorCounts[AUDIO_BUSY_ERROR]++;
+        return AUDIO_BUSY_ERROR;
+    }
+
+    _request.tag = _tag;
+    if (!_requestQueue->push(_request)) {
+        _errorCounts[AUDIO_BUSY_ERROR]++;
+        return AUDIO_BUSY_ERROR;
+    }
+    pending.active = true;
+    pending.readCallback = readCallback;
+    pending.writeCallback = writeCallback;
+    _tag++;
+
+    // only wake the I/O thread if it is not already about to run
+    if (!_wakePending.exchange(true)) {
+        _worker->wake();
+    }
+    return AUDIO_SUCCESS;
+}
+
+bool ControlLink::processResults()
+{
+    bool processed = false;
+    LinkResult &result = _result;
+    while (_resultQueue->pop(result)) {
+        Pending &pending = _pending[result.tag & (LINK_QUEUE_SIZE-1)];
+        IRegisterAccess::ReadCallback readCallback = std::move(pending.readCallback);
+        IRegisterAccess::WriteCallback writeCallback = std::move(pending.writeCallback);
+        pending.active = false;
+        pending.readCallback = nullptr;
+        pending.writeCallback = nullptr;
+        if ((result.error >= 0) && (result.error < AUDIO_ERROR_COUNT)) {
+            _errorCounts[result.error]++;
+        }
+
+        if (readCallback) {
+            readCallback(result.error, result.data, result.length);
+        }
+        if (writeCallback) {
+            writeCallback(result.error);
+        }
+        processed = true;
+    }
+    return processed;
+}
@@ -0,0 +1,114 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : controllink.h
+// Changelog : 17.10.2026 - file created
+//             17.10.2026 - multiple boards
+//             17.10.2026 - request data inline
+//             17.10.2026 - retransmission statistics
+//             17.10.2026 - scheduled writes
+//             17.10.2026 - link metrics
+//             17.10.2026 - board scan
+//             17.10.2026 - batched linux transport
+//             18.10.2026 - blocking calls for the command line tools only
+//------------------------------------------------------------------------------
+
+#ifndef CONTROLLINK_H
+#define CONTROLLINK_H
+
+#include <QObject>
+#include <QThread>
+#include <atomic>
+
+#include "iregisteraccess.h"
+#include "linkworker.h"
+
+// register access for the GUI thread, the network stack runs in its own
+// thread and requests and results are exchanged through lock-free queues
+// board 0 is the target of the settings, more boards share the same socket
+class ControlLink : public QObject
+{
+    Q_OBJECT
+
+public:
+    struct BoardHealth {
+        quint32 requests;
+        quint32 responses;
+        quint32 timeouts;
+        quint32 latePackets;
+        quint32 roundTripTime;   // smoothed, in us
+        quint32 timeout;         // current retransmission timeout, in us
+        quint32 retransmits;
+        int     pending;
+        quint32 orphanedPackets;
+        quint32 formatErrors;    // wrong type or length
+        quint64 sentBytes;
+        quint64 receivedBytes;
+    };
+
+    struct LinkHealth {
+        quint32 unknownPackets;  // from an address that is no board
+        quint32 droppedPackets;
+        quint32 receiveBacklog;  // most datagrams waiting in the socket at once
+    };
+
+    explicit ControlLink(LinkTransport transport = LINK_TRANSPORT_QT, QObject *parent = nullptr);
+    ~ControlLink() override;
+
+    int  readAsync(int board, quint32 address, int length, IRegisterAccess::ReadCallback callback);
+    int  writeAsync(int board, quint32 address, const QVector<quint32> &data, IRegisterAccess::WriteCallback callback);
+    void poll(int waitMs);
+    void setBlockingAllowed(bool allowed);
+    bool isBlockingAllowed();
+    int  scheduleWrite(int board, quint32 address, const quint32 *data, int length, qint64 deadline);
+    LatencyHistogram &getJitter();
+    quint32           getScheduleErrors();
+    LatencyHistogram &getRoundTrip();
+    quint32           getErrorCount(int error);
+
+    QString getAddress();
+    quint16 getPort();
+    bool    setAddress(QString address);
+    bool    setPort(quint16 port);
+
+    int     addBoard(QString address);
+    void    removeBoard(int board);
+    bool    setBoardAddress(int board, QString address);
+    void    getHealth(int board, BoardHealth &health);
+    void    getLinkHealth(LinkHealth &health);
+    bool    startScan();
+    void    getScanResults(QVector<BoardScanner::Result> &results);
+
+signals:
+    void scanFinished();
+
+private:
+    struct Pending {
+        bool                           active;
+        IRegisterAccess::ReadCallback  readCallback;
+        IRegisterAccess::WriteCallback writeCallback;
+    };
+
+    int  submit(IRegisterAccess::ReadCallback readCallback, IRegisterAccess::WriteCallback writeCallback);
+    bool processResults();
+
+    QThread           _thread;
+    LinkRequestQueue  *_requestQueue;
+    LinkResultQueue   *_resultQueue;
+    LinkSchedule      *_schedule;
+    LinkMetrics       *_metrics;
+    LinkScan          *_scan;
+    std::atomic<bool> _wakePending;
+    LinkStatistics    _statistics[LINK_MAX_BOARDS];
+    LinkWorker        *_worker;
+    quint32           _tag;
+    bool              _blockingAllowed;
+    quint32           _errorCounts[AUDIO_ERROR_COUNT];   // results by error code
+    Pending           _pending[LINK_QUEUE_SIZE];
+    LinkRequest       _request;
+    LinkResult        _result;
+    LinkRequest       _scheduleRequest;   // used by the scheduler thread only
+
+};
+
+#endif // CONTROLLINK_H
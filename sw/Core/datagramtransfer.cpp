@@ -0,0 +1,457 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : datagramtransfer.cpp
+// Changelog : 17.10.2026 - file created
+//             18.10.2026 - peers added under the lock
+//             18.10.2026 - send time error of scheduled datagrams
+//             18.10.2026 - all peer accessors locked
+//------------------------------------------------------------------------------
+
+#include "datagramtransfer.h"
+#include "packetcodec.h"
+
+#include <chrono>
+
+DatagramTransfer::DatagramTransfer(QObject *parent) :
+    QObject(parent),
+    _targetAddressString("192.168.1.100"),
+    _targetAddress(_targetAddressString),
+    _hostAddressString("192.168.1.0"),
+    _hostAddress(_hostAddressString),
+    _port(4660),
+    _unknownPackets(0),
+    _droppedPackets(0),
+    _receiveBacklog(0),
+    _sendJitter(nullptr)
+{
+    // the subclass binds its socket to the host address
+    addPeer(_targetAddressString);
+    _hostAddressString = getLocalAddress();
+    _hostAddress.setAddress(_hostAddressString);
+}
+
+DatagramTransfer::~DatagramTransfer()
+{
+    foreach (Peer *peer, _peers) {
+        delete peer;
+    }
+}
+
+QString DatagramTransfer::getLocalAddress()
+{
+    // address of the first interface in the subnet of the target
+    foreach (const QNetworkInterface& networkInterface, QNetworkInterface::allInterfaces()) {
+        foreach (const QNetworkAddressEntry& entry, networkInterface.addressEntries()) {
+            if ((entry.prefixLength() >= 0) && _targetAddress.isInSubnet(entry.ip(), entry.prefixLength())) {
+                return entry.ip().toString();
+            }
+        }
+    }
+    return QString();
+}
+
+QString DatagramTransfer::getAddress()
+{
+    return _targetAddressString;
+}
+
+QHostAddress DatagramTransfer::getHostAddress()
+{
+    // null if the socket is bound to all interfaces
+    return _hostAddress;
+}
+
+quint16 DatagramTransfer::getPort()
+{
+    return _port;
+}
+
+bool DatagramTransfer::setAddress(QString address)
+{
+    if (_targetAddressString != address) {
+        _targetAddressString = address;
+        _targetAddress.setAddress(_targetAddressString);
+        setPeerAddress(0, _targetAddressString);
+        QString localAddress = getLocalAddress();
+        if (_hostAddressString != localAddress) {
+            _hostAddressString = localAddress;
+            _hostAddress.setAddress(_hostAddressString);
+            updateSocket();
+            return true;
+        }
+    }
+    return false;
+}
+
+bool DatagramTransfer::setPort(quint16 port)
+{
+    if (port != _port) {
+        _port = port;
+        updateSocket();
+        return true;
+    }
+    return false;
+}
+
+void DatagramTransfer::flush()
+{
+    // datagrams are sent right away unless the transport batches them
+}
+
+int DatagramTransfer::addPeer(QString address)
+{
+    // locked as a whole, two threads must not take the same free entry
+    _mutex.lock();
+    int index = 0;
+    while ((index < _peers.length()) && _peers[index]->active) {
+        index++;
+    }
+    if (index == _peers.length()) {
+        // the receive slots grow to the packet size once and are reused afterwards
+        Peer *peer = new Peer();
+        peer->receiveTable.resize(SLOT_COUNT);
+        _peers.append(peer);
+    }
+
+    Peer *peer = _peers[index];
+    peer->active = true;
+    peer->address.setAddress(address);
+    for (int id=0; id<SLOT_COUNT; id++) {
+        peer->receiveTable[id].state = SLOT_FREE;
+        peer->receiveTable[id].sendNs = 0;
+        peer->receiveTable[id].roundTripNs = -1;
+    }
+    peer->receivedPackets = 0;
+    peer->latePackets = 0;
+    peer->orphanedPackets = 0;
+    peer->sentBytes = 0;
+    peer->receivedBytes = 0;
+    updatePeerIndex();
+    _mutex.unlock();
+
+    return index;
+}
+
+void DatagramTransfer::removePeer(int peer)
+{
+    // the primary target stays
+    _mutex.lock();
+    if ((peer > 0) && isActivePeer(peer)) {
+        _peers[peer]->active = false;
+        updatePeerIndex();
+    }
+    _mutex.unlock();
+}
+
+int DatagramTransfer::findPeer(quint32 address)
+{
+    _mutex.lock();
+    int peer = _peerIndex.value(address, -1);
+    _mutex.unlock();
+    return peer;
+}
+
+bool DatagramTransfer::isPeer(int peer)
+{
+    _mutex.lock();
+    bool active = isActivePeer(peer);
+    _mutex.unlock();
+    return active;
+}
+
+bool DatagramTransfer::isActivePeer(int peer)
+{
+    // the caller holds the mutex, addPeer() may move the vector
+    return (peer >= 0) && (peer < _peers.length()) && _peers[peer]->active;
+}
+
+QString DatagramTransfer::getPeerAddress(int peer)
+{
+    QString address;
+    _mutex.lock();
+    if (isActivePeer(peer)) {
+        address = _peers[peer]->address.toString();
+    }
+    _mutex.unlock();
+    return address;
+}
+
+bool DatagramTransfer::setPeerAddress(int peer, QString address)
+{
+    _mutex.lock();
+    bool active = isActivePeer(peer);
+    if (active) {
+        _peers[peer]->address.setAddress(address);
+        updatePeerIndex();
+    }
+    _mutex.unlock();
+    return active;
+}
+
+void DatagramTransfer::updatePeerIndex()
+{
+    _peerIndex.clear();
+    for (int index=0; index<_peers.length(); index++) {
+        if (_peers[index]->active) {
+            _peerIndex.insert(_peers[index]->address.toIPv4Address(), index);
+        }
+    }
+}
+
+void DatagramTransfer::sendPacket(int peer, const char *data, int size, qint64 deadlineNs)
+{
+    // deadlineNs is the planned send time of a scheduled datagram, 0 otherwise.
+    // sent without the mutex, a batched transport sets the send times
+    _mutex.lock();
+    if (!isActivePeer(peer)) {
+        _mutex.unlock();
+        return;
+    }
+    quint32 address = _peers[peer]->address.toIPv4Address();
+    _peers[peer]->sentBytes += static_cast<quint64>(size);
+    _mutex.unlock();
+    sendDatagram(peer, address, data, size, deadlineNs);
+}
+
+void DatagramTransfer::sendPacketTo(quint32 address, const char *data, int size)
+{
+    // to a host that is no peer, e.g. by the board scan
+    sendDatagram(-1, address, data, size, 0);
+}
+
+void DatagramTransfer::expectPacket(int peer, quint8 id)
+{
+    _mutex.lock();
+    if (!isActivePeer(peer)) {
+        _mutex.unlock();
+        return;
+    }
+    ReceiveSlot &slot = _peers[peer]->receiveTable[id];
+    slot.state = SLOT_EXPECTED;
+    slot.sendNs = 0;
+    slot.roundTripNs = -1;
+    _mutex.unlock();
+}
+
+void DatagramTransfer::releasePacket(int peer, quint8 id)
+{
+    _mutex.lock();
+    if (!isActivePeer(peer)) {
+        _mutex.unlock();
+        return;
+    }
+    ReceiveSlot &slot = _peers[peer]->receiveTable[id];
+    if (slot.state == SLOT_EXPECTED) {
+        slot.state = SLOT_RELEASED;
+    } else {
+        slot.state = SLOT_FREE;
+    }
+    _mutex.unlock();
+}
+
+bool DatagramTransfer::readPacket(int peer, quint8 id, const char *&data, int &size, int waitMs)
+{
+    if (takePacket(peer, id, data, size)) {
+        return true;
+    }
+    if (waitMs > 0) {
+        waitForPacket(waitMs);
+        return takePacket(peer, id, data, size);
+    }
+    return false;
+}
+
+bool DatagramTransfer::takePacket(int peer, quint8 id, const char *&data, int &size)
+{
+    // the packet stays in the slot until the id is expected again
+    bool received = false;
+    _mutex.lock();
+    if (!isActivePeer(peer)) {
+        _mutex.unlock();
+        return false;
+    }
+    ReceiveSlot &slot = _peers[peer]->receiveTable[id];
+    if (slot.state == SLOT_RECEIVED) {
+        data = slot.data.constData();
+        size = slot.data.size();
+        slot.state = SLOT_FREE;
+        received = true;
+    }
+    _mutex.unlock();
+    return received;
+}
+
+qint64 DatagramTransfer::getRoundTripTime(int peer, quint8 id)
+{
+    // of the last response with this id, -1 if the transport has no timestamps
+    _mutex.lock();
+    if (!isActivePeer(peer)) {
+        _mutex.unlock();
+        return -1;
+    }
+    qint64 roundTripNs = _peers[peer]->receiveTable[id].roundTripNs;
+    _mutex.unlock();
+    return roundTripNs;
+}
+
+void DatagramTransfer::setSendTime(int peer, quint8 id, qint64 sendNs)
+{
+    // only reads wait for a response, a later timestamp of the kernel
+    // replaces the one taken before the system call
+    _mutex.lock();
+    if (!isActivePeer(peer)) {
+        _mutex.unlock();
+        return;
+    }
+    ReceiveSlot &slot = _peers[peer]->receiveTable[id];
+    if (slot.state == SLOT_EXPECTED) {
+        slot.sendNs = sendNs;
+    }
+    _mutex.unlock();
+}
+
+quint32 DatagramTransfer::getReceivedPackets(int peer)
+{
+    _mutex.lock();
+    quint32 count = isActivePeer(peer) ? _peers[peer]->receivedPackets : 0;
+    _mutex.unlock();
+    return count;
+}
+
+quint32 DatagramTransfer::getLatePackets(int peer)
+{
+    _mutex.lock();
+    quint32 count = isActivePeer(peer) ? _peers[peer]->latePackets : 0;
+    _mutex.unlock();
+    return count;
+}
+
+quint32 DatagramTransfer::getOrphanedPackets(int peer)
+{
+    _mutex.lock();
+    quint32 count = isActivePeer(peer) ? _peers[peer]->orphanedPackets : 0;
+    _mutex.unlock();
+    return count;
+}
+
+quint64 DatagramTransfer::getSentBytes(int peer)
+{
+    _mutex.lock();
+    quint64 count = isActivePeer(peer) ? _peers[peer]->sentBytes : 0;
+    _mutex.unlock();
+    return count;
+}
+
+quint64 DatagramTransfer::getReceivedBytes(int peer)
+{
+    _mutex.lock();
+    quint64 count = isActivePeer(peer) ? _peers[peer]->receivedBytes : 0;
+    _mutex.unlock();
+    return count;
+}
+
+quint32 DatagramTransfer::getUnknownPackets()
+{
+    _mutex.lock();
+    quint32 count = _unknownPackets;
+    _mutex.unlock();
+    return count;
+}
+
+quint32 DatagramTransfer::getDroppedPackets()
+{
+    _mutex.lock();
+    quint32 count = _droppedPackets;
+    _mutex.unlock();
+    return count;
+}
+
+quint32 DatagramTransfer::getReceiveBacklog()
+{
+    _mutex.lock();
+    quint32 count = _receiveBacklog;
+    _mutex.unlock();
+    return count;
+}
+
+void DatagramTransfer::setSendJitterHistogram(LatencyHistogram *histogram)
+{
+    // nullptr stops recording, the histogram is added to by the thread of
+    // the transport
+    _sendJitter = histogram;
+}
+
+void DatagramTransfer::recordSendTime(qint64 deadlineNs)
+{
+    // called by the subclass when a datagram left, a batched datagram may
+    // wait in the queue or the system call well past its deadline
+    if ((_sendJitter == nullptr) || (deadlineNs <= 0)) {
+        return;
+    }
+    qint64 now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                     std::chrono::steady_clock::now().time_since_epoch()).count();
+    _sendJitter->add(now - deadlineNs);
+}
+
+void DatagramTransfer::countDroppedPacket()
+{
+    _mutex.lock();
+    _droppedPackets++;
+    _mutex.unlock();
+}
+
+void DatagramTransfer::updateReceiveBacklog(quint32 backlog)
+{
+    // the number of datagrams drained at once shows how far the socket
+    // buffer filled up in between
+    _mutex.lock();
+    _receiveBacklog = qMax(_receiveBacklog, backlog);
+    _mutex.unlock();
+}
+
+void DatagramTransfer::receivePacket(quint32 sender, QByteArray &buffer, int size, qint64 receiveNs)
+{
+    // buffer holds the datagram and has MAX_PACKET_SIZE bytes, receiveNs is
+    // the kernel timestamp or 0
+    quint8 id = PacketCodec::getId(buffer.constData());
+    bool matched = false;
+    _mutex.lock();
+    int peer = _peerIndex.value(sender, -1);
+    if (peer < 0) {
+        // valid until the next datagram is read, e.g. for the board scan
+        _unknownPackets++;
+        _mutex.unlock();
+        emit unknownPacketReceived(sender, buffer.constData(), size);
+        return;
+    }
+    Peer *source = _peers[peer];
+    source->receivedBytes += static_cast<quint64>(size);
+    ReceiveSlot &slot = source->receiveTable[id];
+    switch (slot.state) {
+        case SLOT_EXPECTED :
+            // hand the receive buffer over instead of copying, the buffer
+            // of the slot becomes the next receive buffer
+            buffer.resize(size);
+            slot.data.swap(buffer);
+            buffer.resize(PacketCodec::MAX_PACKET_SIZE);
+            slot.state = SLOT_RECEIVED;
+            slot.roundTripNs = ((receiveNs > 0) && (slot.sendNs > 0)) ? (receiveNs - slot.sendNs) : -1;
+            source->receivedPackets++;
+            matched = true;
+            break;
+        case SLOT_RELEASED :
+            // response arrived after the request timed out
+            slot.state = SLOT_FREE;
+            source->latePackets++;
+            break;
+        default :
+            // duplicate or nobody asked for it
+            source->orphanedPackets++;
+    }
+    _mutex.unlock();
+
+    if (matched) {
+        emit packetReceived(peer, id);
+    }
+}
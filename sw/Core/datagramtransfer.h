@@ -0,0 +1,133 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : datagramtransfer.h
+// Changelog : 17.10.2026 - file created
+//             18.10.2026 - send time error of scheduled datagrams
+//             18.10.2026 - all peer accessors locked
+//------------------------------------------------------------------------------
+
+#ifndef DATAGRAMTRANSFER_H
+#define DATAGRAMTRANSFER_H
+
+#include <QObject>
+#include <QHostAddress>
+#include <QNetworkInterface>
+#include <QMutex>
+#include <QHash>
+#include <QVector>
+#include "latencyhistogram.h"
+
+// peers, receive tables and counters shared by the transports, the socket
+// is left to the subclass
+//
+// peer 0 is the target set with setAddress(), more boards can be added
+// with addPeer(), responses are demultiplexed by their source address.
+// a subclass sends the datagrams handed to sendDatagram() and passes every
+// datagram it receives to receivePacket()
+class DatagramTransfer : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit DatagramTransfer(QObject *parent = nullptr);
+    ~DatagramTransfer() override;
+
+    void    sendPacket(int peer, const char *data, int size, qint64 deadlineNs = 0);
+    void    sendPacketTo(quint32 address, const char *data, int size);
+    void    expectPacket(int peer, quint8 id);
+    void    releasePacket(int peer, quint8 id);
+    bool    readPacket(int peer, quint8 id, const char *&data, int &size, int waitMs);
+    qint64  getRoundTripTime(int peer, quint8 id);
+    QString getAddress();
+    QHostAddress getHostAddress();
+    quint16 getPort();
+    bool    setAddress(QString address);
+    bool    setPort(quint16 port);
+
+    // waits for datagrams and delivers them, flush() sends queued datagrams
+    virtual void waitForPacket(int waitMs) = 0;
+    virtual void flush();
+
+    int     addPeer(QString address);
+    void    removePeer(int peer);
+    int     findPeer(quint32 address);
+    bool    isPeer(int peer);
+    QString getPeerAddress(int peer);
+    bool    setPeerAddress(int peer, QString address);
+
+    quint32 getReceivedPackets(int peer);
+    quint32 getLatePackets(int peer);
+    quint32 getOrphanedPackets(int peer);
+    quint64 getSentBytes(int peer);
+    quint64 getReceivedBytes(int peer);
+    quint32 getUnknownPackets();
+    quint32 getDroppedPackets();
+    quint32 getReceiveBacklog();
+    void    setSendJitterHistogram(LatencyHistogram *histogram);
+
+signals:
+    void packetReceived(int peer, quint8 id);
+    void unknownPacketReceived(quint32 sender, const char *data, int size);
+
+protected:
+    // peer is -1 for a host that is no peer, deadlineNs is 0 unless the
+    // datagram was scheduled, see recordSendTime()
+    virtual void sendDatagram(int peer, quint32 address, const char *data, int size, qint64 deadlineNs) = 0;
+    virtual void updateSocket() = 0;
+
+    void receivePacket(quint32 sender, QByteArray &buffer, int size, qint64 receiveNs);
+    void setSendTime(int peer, quint8 id, qint64 sendNs);
+    void recordSendTime(qint64 deadlineNs);
+    void countDroppedPacket();
+    void updateReceiveBacklog(quint32 backlog);
+
+private:
+    enum SlotState {
+        SLOT_FREE,      // no response expected
+        SLOT_EXPECTED,  // request sent, waiting for response
+        SLOT_RECEIVED,  // response stored, waiting for readPacket()
+        SLOT_RELEASED   // request given up, a late response is discarded
+    };
+
+    struct ReceiveSlot {
+        SlotState  state;
+        QByteArray data;
+        qint64     sendNs;        // set by transports with timestamps, 0 otherwise
+        qint64     roundTripNs;   // -1 if not measured by the transport
+    };
+
+    struct Peer {
+        bool                 active;
+        QHostAddress         address;
+        QVector<ReceiveSlot> receiveTable;
+        quint32              receivedPackets;
+        quint32              latePackets;
+        quint32              orphanedPackets;
+        quint64              sentBytes;
+        quint64              receivedBytes;
+    };
+
+    static const int SLOT_COUNT       = 256;
+
+    QString getLocalAddress();
+    bool    isActivePeer(int peer);
+    void    updatePeerIndex();
+    bool    takePacket(int peer, quint8 id, const char *&data, int &size);
+
+    QString              _targetAddressString;
+    QHostAddress         _targetAddress;
+    QString              _hostAddressString;
+    QHostAddress         _hostAddress;
+    quint16              _port;
+    QVector<Peer *>      _peers;
+    QHash<quint32, int>  _peerIndex;
+    quint32              _unknownPackets;
+    quint32              _droppedPackets;
+    quint32              _receiveBacklog;   // most datagrams drained at once
+    QMutex               _mutex;            // peers and counters, read by other threads
+    LatencyHistogram     *_sendJitter;
+
+};
+
+#endif // DATAGRAMTRANSFER_H
@@ -0,0 +1,163 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : devicemanager.cpp
+// Changelog : 17.10.2026 - file created
+//             17.10.2026 - telemetry recording
+//             17.10.2026 - scene recall
+//             17.10.2026 - board scan
+//             17.10.2026 - link transport selectable
+//------------------------------------------------------------------------------
+
+#include "devicemanager.h"
+
+DeviceManager::DeviceManager(LinkTransport transport, QObject *parent) :
+    QObject(parent),
+    _controlLink(transport, this),
+    _timer(this),
+    _nextSession(0),
+    _recorder(nullptr)
+{
+    // board 0 follows the address of the settings
+    _sessions.append(new BoardSession(_controlLink, 0, _controlLink.getAddress(), this));
+
+    connect(&_controlLink, SIGNAL(scanFinished()), this, SIGNAL(scanFinished()));
+    connect(&_timer, SIGNAL(timeout()), this, SLOT(update()));
+    _timer.start(20);
+}
+
+DeviceManager::~DeviceManager()
+{
+    // the sessions must be gone before the link thread is stopped
+    foreach (BoardSession *session, _sessions) {
+        delete session;
+    }
+}
+
+BoardSession *DeviceManager::addBoard(QString address)
+{
+    int board = _controlLink.addBoard(address);
+    if (board < 0) {
+        return nullptr;
+    }
+    BoardSession *session = new BoardSession(_controlLink, board, address, this);
+    session->getUpdater().setRecorder(_recorder, board);
+    _sessions.append(session);
+    return session;
+}
+
+void DeviceManager::removeBoard(BoardSession *session)
+{
+    int index = _sessions.indexOf(session);
+    if (index <= 0) {
+        return;
+    }
+    _sessions.remove(index);
+    _controlLink.removeBoard(session->getBoard());
+    // cancelled requests still reference the session
+    _controlLink.poll(0);
+    delete session;
+}
+
+BoardSession *DeviceManager::getSession(int index)
+{
+    return _sessions.value(index, nullptr);
+}
+
+BoardSession *DeviceManager::getPrimarySession()
+{
+    return _sessions.first();
+}
+
+int DeviceManager::getSessionCount()
+{
+    return _sessions.length();
+}
+
+ControlLink &DeviceManager::getControlLink()
+{
+    return _controlLink;
+}
+
+void DeviceManager::setInterval(int intervalMs)
+{
+    _timer.start(intervalMs);
+}
+
+void DeviceManager::setRecorder(TelemetryRecorder *recorder)
+{
+    // the samples are tagged with the board index of the ControlLink
+    _recorder = recorder;
+    foreach (BoardSession *session, _sessions) {
+        session->getUpdater().setRecorder(_recorder, session->getBoard());
+    }
+}
+
+void DeviceManager::recallScene(const Scene &scene)
+{
+    // all boards send their differences at once, the recall takes one round trip
+    foreach (BoardSession *session, _sessions) {
+        session->getUpdater().recallScene(scene);
+    }
+}
+
+bool DeviceManager::isRecallPending()
+{
+    foreach (BoardSession *session, _sessions) {
+        if (session->getUpdater().isRecallPending()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool DeviceManager::startScan()
+{
+    // scanFinished() is emitted when the results are ready
+    return _controlLink.startScan();
+}
+
+void DeviceManager::getScanResults(QVector<BoardScanner::Result> &results)
+{
+    _controlLink.getScanResults(results);
+}
+
+QVector<BoardSession *> DeviceManager::addScannedBoards()
+{
+    // boards of the last scan that have no session yet
+    QVector<BoardScanner::Result> results;
+    _controlLink.getScanResults(results);
+    QVector<BoardSession *> added;
+    foreach (const BoardScanner::Result &result, results) {
+        bool known = false;
+        foreach (BoardSession *session, _sessions) {
+            if (QHostAddress(session->getAddress()) == QHostAddress(result.address)) {
+                known = true;
+                break;
+            }
+        }
+        if (known) {
+            continue;
+        }
+        BoardSession *session = addBoard(result.address);
+        if (session == nullptr) {
+            break;
+        }
+        added.append(session);
+    }
+    return added;
+}
+
+void DeviceManager::update()
+{
+    // collect the results of all boards once
+    _controlLink.poll(0);
+
+    // start with a different board every tick so no board is always served
+    // last when the request queue runs full
+    int count = _sessions.length();
+    for (int offset=0; offset<count; offset++) {
+        _sessions[(_nextSession + offset) % count]->update();
+    }
+    _nextSession = (_nextSession + 1) % count;
+}
@@ -0,0 +1,63 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : devicemanager.h
+// Changelog : 17.10.2026 - file created
+//             17.10.2026 - telemetry recording
+//             17.10.2026 - scene recall
+//             17.10.2026 - board scan
+//             17.10.2026 - link transport selectable
+//------------------------------------------------------------------------------
+
+#ifndef DEVICEMANAGER_H
+#define DEVICEMANAGER_H
+
+#include <QObject>
+#include <QTimer>
+#include <QVector>
+
+#include "controllink.h"
+#include "boardsession.h"
+#include "telemetryrecorder.h"
+#include "scene.h"
+
+// holds the sessions of all boards, they share one ControlLink and thus one
+// socket and one I/O thread, a single timer updates them in turn
+class DeviceManager : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit DeviceManager(LinkTransport transport = LINK_TRANSPORT_QT, QObject *parent = nullptr);
+    ~DeviceManager() override;
+
+    BoardSession *addBoard(QString address);
+    void          removeBoard(BoardSession *session);
+    BoardSession *getSession(int index);
+    BoardSession *getPrimarySession();
+    int           getSessionCount();
+    ControlLink  &getControlLink();
+    void          setInterval(int intervalMs);
+    void          setRecorder(TelemetryRecorder *recorder);
+    void          recallScene(const Scene &scene);
+    bool          isRecallPending();
+    bool          startScan();
+    void          getScanResults(QVector<BoardScanner::Result> &results);
+    QVector<BoardSession *> addScannedBoards();
+
+public slots:
+    void update();
+
+signals:
+    void scanFinished();
+
+private:
+    ControlLink             _controlLink;
+    QVector<BoardSession *> _sessions;
+    QTimer                  _timer;
+    int                     _nextSession;
+    TelemetryRecorder       *_recorder;
+
+};
+
+#endif // DEVICEMANAGER_H
@@ -0,0 +1,203 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : impulseresponse.cpp
+// Changelog : 17.10.2026 - file created
+//             17.10.2026 - normalization scale exposed
+//------------------------------------------------------------------------------
+
+#include "impulseresponse.h"
+#include "typedefinitions.h"
+#include <QFile>
+#include <QtEndian>
+#include <QtMath>
+
+ImpulseResponse::ImpulseResponse() :
+    _sampleRate(0)
+{
+}
+
+int ImpulseResponse::load(QString fileName)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return AUDIO_FILE_ERROR;
+    }
+    QByteArray content = file.readAll();
+    if (content.startsWith("RIFF")) {
+        return parseWav(content);
+    }
+    // anything else is taken as mono 32 bit float
+    return loadRaw(fileName, 1);
+}
+
+int ImpulseResponse::loadRaw(QString fileName, int channels)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return AUDIO_FILE_ERROR;
+    }
+    QByteArray content = file.readAll();
+    int frameSize = channels * static_cast<int>(sizeof(float));
+    if ((channels < 1) || (content.size() < frameSize) || (content.size() % frameSize)) {
+        return AUDIO_FILE_FORMAT_ERROR;
+    }
+
+    int count = content.size() / static_cast<int>(sizeof(float));
+    QVector<float> samples(count);
+    for (int index=0; index<count; index++) {
+        quint32 bits = qFromLittleEndian<quint32>(reinterpret_cast<const uchar *>(content.constData()) + index*4);
+        memcpy(&samples[index], &bits, sizeof(float));
+    }
+    deinterleave(samples.constData(), count / channels, channels);
+    _sampleRate = 0;
+    return AUDIO_SUCCESS;
+}
+
+int ImpulseResponse::parseWav(const QByteArray &file)
+{
+    const uchar *data = reinterpret_cast<const uchar *>(file.constData());
+    int size = file.size();
+    if ((size < 12) || (file.mid(8, 4) != "WAVE")) {
+        return AUDIO_FILE_FORMAT_ERROR;
+    }
+
+    int format = 0;
+    int channels = 0;
+    int bits = 0;
+    int sampleRate = 0;
+    int dataOffset = -1;
+    int dataSize = 0;
+    int offset = 12;
+    while (offset+8 <= size) {
+        QByteArray id = file.mid(offset, 4);
+        int chunkSize = static_cast<int>(qFromLittleEndian<quint32>(data+offset+4));
+        int body = offset + 8;
+        if ((chunkSize < 0) || (body+chunkSize > size)) {
+            chunkSize = size - body;
+        }
+        if ((id == "fmt ") && (chunkSize >= 16)) {
+            format = qFromLittleEndian<quint16>(data+body);
+            channels = qFromLittleEndian<quint16>(data+body+2);
+            sampleRate = static_cast<int>(qFromLittleEndian<quint32>(data+body+4));
+            bits = qFromLittleEndian<quint16>(data+body+14);
+            // WAVE_FORMAT_EXTENSIBLE carries the real format in the sub format
+            if ((format == 0xfffe) && (chunkSize >= 26)) {
+                format = qFromLittleEndian<quint16>(data+body+24);
+            }
+        } else if (id == "data") {
+            dataOffset = body;
+            dataSize = chunkSize;
+        }
+        // chunks are padded to an even size
+        offset = body + chunkSize + (chunkSize & 1);
+    }
+
+    bool pcm = (format == 1) && ((bits == 16) || (bits == 24) || (bits == 32));
+    bool ieeeFloat = (format == 3) && (bits == 32);
+    if ((dataOffset < 0) || (channels < 1) || (!pcm && !ieeeFloat)) {
+        return AUDIO_FILE_FORMAT_ERROR;
+    }
+
+    int sampleSize = bits / 8;
+    int frames = dataSize / (sampleSize*channels);
+    if (frames < 1) {
+        return AUDIO_FILE_FORMAT_ERROR;
+    }
+    QVector<float> samples(frames*channels);
+    const uchar *sample = data + dataOffset;
+    for (int index=0; index<samples.length(); index++) {
+        if (ieeeFloat) {
+            quint32 raw = qFromLittleEndian<quint32>(sample);
+            memcpy(&samples[index], &raw, sizeof(float));
+        } else if (bits == 16) {
+            samples[index] = qFromLittleEndian<qint16>(sample) / 32768.0f;
+        } else if (bits == 24) {
+            // sign extend through the upper byte of a 32 bit word
+            qint32 value = static_cast<qint32>((static_cast<quint32>(sample[2])<<24) | (static_cast<quint32>(sample[1])<<16) |
+                                               (static_cast<quint32>(sample[0])<<8)) >> 8;
+            samples[index] = value / 8388608.0f;
+        } else {
+            samples[index] = static_cast<float>(qFromLittleEndian<qint32>(sample) / 2147483648.0);
+        }
+        sample += sampleSize;
+    }
+    deinterleave(samples.constData(), frames, channels);
+    _sampleRate = sampleRate;
+    return AUDIO_SUCCESS;
+}
+
+void ImpulseResponse::deinterleave(const float *samples, int frames, int channels)
+{
+    _channels.resize(channels);
+    for (int channel=0; channel<channels; channel++) {
+        _channels[channel].resize(frames);
+        for (int frame=0; frame<frames; frame++) {
+            _channels[channel][frame] = samples[frame*channels + channel];
+        }
+    }
+}
+
+int ImpulseResponse::getChannelCount()
+{
+    return _channels.length();
+}
+
+int ImpulseResponse::getLength()
+{
+    return _channels.isEmpty() ? 0 : _channels[0].length();
+}
+
+int ImpulseResponse::getSampleRate()
+{
+    // 0 for raw files
+    return _sampleRate;
+}
+
+const QVector<float> &ImpulseResponse::getChannel(int channel)
+{
+    return _channels[channel];
+}
+
+double ImpulseResponse::getScale(int channel, Normalization normalization, int taps)
+{
+    // measured on the taps that are loaded, an untruncated preview uses the
+    // same scale to stay comparable
+    const QVector<float> &response = _channels[qMin(channel, _channels.length()-1)];
+    int length = qMin(taps, response.length());
+
+    double peak = 0.0;
+    double sum = 0.0;
+    for (int tap=0; tap<length; tap++) {
+        peak = qMax(peak, qAbs(static_cast<double>(response[tap])));
+        sum += qAbs(static_cast<double>(response[tap]));
+    }
+    if ((normalization == NORMALIZE_PEAK) && (peak > 0.0)) {
+        return 1.0 / peak;
+    } else if ((normalization == NORMALIZE_SUM) && (sum > 0.0)) {
+        return 1.0 / sum;
+    }
+    return 1.0;
+}
+
+void ImpulseResponse::quantize(int channel, Normalization normalization, quint32 *coefficients, int taps)
+{
+    // a mono response is used for every channel
+    const QVector<float> &response = _channels[qMin(channel, _channels.length()-1)];
+    int length = qMin(taps, response.length());
+    double scale = getScale(channel, normalization, taps);
+
+    // signed fraction with 23 bits after the point, the longer responses are
+    // cut and the shorter ones padded with zeros
+    const qint32 maxValue = (1 << (COEFFICIENT_BITS-1)) - 1;
+    const qint32 minValue = -(1 << (COEFFICIENT_BITS-1));
+    const quint32 mask = (1u << COEFFICIENT_BITS) - 1;
+    for (int tap=0; tap<taps; tap++) {
+        qint32 value = 0;
+        if (tap < length) {
+            qint64 scaled = qRound64(response[tap] * scale * (1 << (COEFFICIENT_BITS-1)));
+            value = static_cast<qint32>(qBound(static_cast<qint64>(minValue), scaled, static_cast<qint64>(maxValue)));
+        }
+        coefficients[tap] = static_cast<quint32>(value) & mask;
+    }
+}
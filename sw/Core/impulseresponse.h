@@ -0,0 +1,48 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : impulseresponse.h
+// Changelog : 17.10.2026 - file created
+//             17.10.2026 - normalization scale exposed
+//------------------------------------------------------------------------------
+
+#ifndef IMPULSERESPONSE_H
+#define IMPULSERESPONSE_H
+
+#include <QString>
+#include <QVector>
+
+// impulse response from a wav or raw float file, quantized to the
+// 24 bit coefficients of convolution.vhd
+class ImpulseResponse
+{
+
+public:
+    enum Normalization {
+        NORMALIZE_NONE,     // samples taken as they are
+        NORMALIZE_PEAK,     // largest tap at full scale
+        NORMALIZE_SUM       // sum of all taps at full scale, can not clip
+    };
+
+    ImpulseResponse();
+
+    int   load(QString fileName);
+    int   loadRaw(QString fileName, int channels);
+    int   getChannelCount();
+    int   getLength();
+    int   getSampleRate();
+    const QVector<float> &getChannel(int channel);
+    double getScale(int channel, Normalization normalization, int taps);
+    void  quantize(int channel, Normalization normalization, quint32 *coefficients, int taps);
+
+    static const int COEFFICIENT_BITS = 24;
+
+private:
+    int   parseWav(const QByteArray &file);
+    void  deinterleave(const float *samples, int frames, int channels);
+
+    QVector<QVector<float>> _channels;
+    int                     _sampleRate;
+};
+
+#endif // IMPULSERESPONSE_H
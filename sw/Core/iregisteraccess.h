@@ -0,0 +1,34 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 20.01.2019
+// Filename  : iregisteraccess.h
+// Changelog : 20.01.2019 - file created
+//             17.10.2026 - asynchronous access added
+//             17.10.2026 - read data passed in place
+//------------------------------------------------------------------------------
+
+#ifndef IREGISTERACCESS_H
+#define IREGISTERACCESS_H
+
+#include <QVector>
+#include <functional>
+
+class IRegisterAccess
+{
+
+public:
+    // data points to length words and is only valid during the call
+    typedef std::function<void(int error, const quint32 *data, int length)> ReadCallback;
+    typedef std::function<void(int error)> WriteCallback;
+
+    virtual ~IRegisterAccess() = 0;
+    virtual int read(quint32 address, QVector<quint32> &data, int length) = 0;
+    virtual int write(quint32 address, QVector<quint32> &data) = 0;
+
+    // callbacks are invoked from poll() once the request completed or failed
+    virtual int  readAsync(quint32 address, int length, ReadCallback callback) = 0;
+    virtual int  writeAsync(quint32 address, const QVector<quint32> &data, WriteCallback callback) = 0;
+    virtual void poll(int waitMs) = 0;
+};
+
+#endif // IREGISTERACCESS_H
@@ -3,20 +3,22 @@
 // Date      : 20.01.2019
 // Filename  : iupdateelement.h
 // Changelog : 20.01.2019 - file created
+//             17.10.2026 - no widget base class, usable without gui
+//             17.10.2026 - recall of scene values
 //------------------------------------------------------------------------------
 
 #ifndef IUPDATEELEMENT_H
 #define IUPDATEELEMENT_H
 
-#include <QWidget>
-
-class IUpdateElement : public QWidget
+// value source or sink of the Updater, widgets implement it next to QWidget
+class IUpdateElement
 {
-    Q_OBJECT
 
 public:
     virtual ~IUpdateElement() {}
     virtual void updateParam(unsigned int *param) = 0;
+    // a write element takes the value of a recalled scene, e.g. a fader moves
+    virtual void recallParam(unsigned int param) { (void)param; }
 };
 
 #endif // IUPDATEELEMENT_H
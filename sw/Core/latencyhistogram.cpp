@@ -0,0 +1,102 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : latencyhistogram.cpp
+// Changelog : 17.10.2026 - file created
+//             17.10.2026 - renamed from JitterHistogram, used for all latencies
+//------------------------------------------------------------------------------
+
+#include "latencyhistogram.h"
+
+#include <chrono>
+
+namespace {
+    qint64 getTime()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+}
+
+LatencyHistogram::LatencyHistogram()
+{
+    clear();
+}
+
+void LatencyHistogram::clear()
+{
+    for (int index=0; index<BUCKET_COUNT; index++) {
+        _buckets[index].store(0, std::memory_order_relaxed);
+    }
+    _count.store(0, std::memory_order_relaxed);
+    _max.store(0, std::memory_order_relaxed);
+}
+
+void LatencyHistogram::add(qint64 durationNs)
+{
+    // early and late count the same for a send time error
+    qint64 duration = (durationNs < 0) ? -durationNs : durationNs;
+    qint64 index = duration / (BUCKET_WIDTH * 1000);
+    if (index >= BUCKET_COUNT) {
+        index = BUCKET_COUNT - 1;
+    }
+    // single writer, plain stores instead of read-modify-write
+    std::atomic<quint32> &bucket = _buckets[index];
+    bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    if (duration > _max.load(std::memory_order_relaxed)) {
+        _max.store(duration, std::memory_order_relaxed);
+    }
+    _count.store(_count.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+quint32 LatencyHistogram::getCount()
+{
+    return _count.load(std::memory_order_acquire);
+}
+
+quint32 LatencyHistogram::getBucket(int index)
+{
+    if ((index < 0) || (index >= BUCKET_COUNT)) {
+        return 0;
+    }
+    return _buckets[index].load(std::memory_order_relaxed);
+}
+
+qint64 LatencyHistogram::getMax()
+{
+    // in us
+    return _max.load(std::memory_order_relaxed) / 1000;
+}
+
+qint64 LatencyHistogram::getPercentile(double percent)
+{
+    // upper edge of the bucket that holds the percentile in us, an upper
+    // bound of the error for the given share of the requests
+    quint32 count = getCount();
+    if (count == 0) {
+        return 0;
+    }
+    quint64 limit = static_cast<quint64>(count * percent / 100.0 + 0.5);
+    quint64 sum = 0;
+    for (int index=0; index<BUCKET_COUNT-1; index++) {
+        sum += _buckets[index].load(std::memory_order_relaxed);
+        if (sum >= limit) {
+            return static_cast<qint64>(index + 1) * BUCKET_WIDTH;
+        }
+    }
+    return getMax();
+}
+
+LatencyScope::LatencyScope(LatencyHistogram *histogram) :
+    _histogram(histogram),
+    _start((histogram != nullptr) ? getTime() : 0)
+{
+
+}
+
+LatencyScope::~LatencyScope()
+{
+    if (_histogram != nullptr) {
+        _histogram->add(getTime() - _start);
+    }
+}
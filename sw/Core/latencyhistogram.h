@@ -0,0 +1,58 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : latencyhistogram.h
+// Changelog : 17.10.2026 - file created
+//             17.10.2026 - renamed from JitterHistogram, used for all latencies
+//------------------------------------------------------------------------------
+
+#ifndef LATENCYHISTOGRAM_H
+#define LATENCYHISTOGRAM_H
+
+#include <QtGlobal>
+#include <atomic>
+
+// fixed bucket distribution of a duration, e.g. the round trip time, the
+// paint time or the send time error of scheduled requests
+//
+// add() is called by one thread only, e.g. the I/O thread, and costs a few
+// ns as it does not need locked instructions. the getters may be called
+// from any thread
+class LatencyHistogram
+{
+
+public:
+    static const int BUCKET_COUNT = 200;
+    static const int BUCKET_WIDTH = 25;   // us, the last bucket takes everything above
+
+    LatencyHistogram();
+    void    clear();
+    void    add(qint64 durationNs);
+    quint32 getCount();
+    quint32 getBucket(int index);
+    qint64  getMax();
+    qint64  getPercentile(double percent);
+
+private:
+    std::atomic<quint32> _buckets[BUCKET_COUNT];
+    std::atomic<quint32> _count;
+    std::atomic<qint64>  _max;   // ns
+
+};
+
+// adds its own lifetime to a histogram, e.g. the duration of a paintEvent(),
+// nothing is measured without histogram
+class LatencyScope
+{
+
+public:
+    explicit LatencyScope(LatencyHistogram *histogram);
+    ~LatencyScope();
+
+private:
+    LatencyHistogram *_histogram;
+    qint64           _start;   // ns of std::chrono::steady_clock
+
+};
+
+#endif // LATENCYHISTOGRAM_H
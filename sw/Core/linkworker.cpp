@@ -0,0 +1,319 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : linkworker.cpp
+// Changelog : 17.10.2026 - file created
+//             17.10.2026 - multiple boards
+//             17.10.2026 - request data inline
+//             17.10.2026 - retransmission statistics
+//             17.10.2026 - scheduled writes
+//             17.10.2026 - link metrics
+//             17.10.2026 - board scan
+//             17.10.2026 - batched linux transport
+//             18.10.2026 - jitter recorded at the send time
+//------------------------------------------------------------------------------
+
+#include "linkworker.h"
+#include "udptransfer.h"
+#include "typedefinitions.h"
+#ifdef Q_OS_LINUX
+#include "batchtransfer.h"
+#endif
+
+#include <QCoreApplication>
+#include <QThread>
+#include <QElapsedTimer>
+
+LinkWorker::LinkWorker(LinkRequestQueue &requestQueue, LinkResultQueue &resultQueue, LinkSchedule &schedule,
+                       std::atomic<bool> &wakePending, LinkStatistics *statistics, LinkMetrics &metrics,
+                       LinkScan &scan, LinkTransport transport) :
+    QObject(nullptr),
+    _requestQueue(requestQueue),
+    _resultQueue(resultQueue),
+    _schedule(schedule),
+    _wakePending(wakePending),
+    _statistics(statistics),
+    _metrics(metrics),
+    _scan(scan),
+    _transfer(nullptr),
+    _batchTransfer(nullptr),
+    _scanner(nullptr),
+    _boards(LINK_MAX_BOARDS, nullptr),
+    _pollTimer(nullptr),
+    _batchPolling(false),
+    _writeVector(MAX_TRANSFER_WORDS, 0)
+{
+#ifdef Q_OS_LINUX
+    // the batch transport has no socket notifier, it is created here so
+    // wake() works before the thread started. it moves along as a child
+    if (transport == LINK_TRANSPORT_BATCH) {
+        _batchTransfer = new BatchTransfer(this);
+        _transfer = _batchTransfer;
+    }
+#else
+    Q_UNUSED(transport);
+#endif
+}
+
+void LinkWorker::wake()
+{
+    // called by other threads
+    if (_batchTransfer != nullptr) {
+        _batchTransfer->wake();
+    } else {
+        QMetaObject::invokeMethod(this, "processRequests", Qt::QueuedConnection);
+    }
+}
+
+void LinkWorker::start()
+{
+    // create the socket inside the I/O thread so it is served by its event loop
+    if (_transfer == nullptr) {
+        _transfer = new UdpTransfer(this);
+    }
+    _boards[0] = new RegisterAccess(*_transfer, 0, this);
+    _boards[0]->setRoundTripHistogram(&_metrics.roundTrip);
+    _transfer->setSendJitterHistogram(&_schedule.jitter);
+    _scanner = new BoardScanner(*_transfer, this);
+    connect(_scanner, SIGNAL(finished()), this, SLOT(onScanFinished()));
+    _pollTimer = new QTimer(this);
+    // the timer resolution bounds the retransmission timeout
+    _pollTimer->setTimerType(Qt::PreciseTimer);
+    _pollTimer->setInterval(1);
+    connect(_pollTimer, SIGNAL(timeout()), this, SLOT(onPollTimer()));
+
+    // started once the event loop of the thread runs
+    if (_batchTransfer != nullptr) {
+        QMetaObject::invokeMethod(this, "runBatchLoop", Qt::QueuedConnection);
+    }
+}
+
+void LinkWorker::runBatchLoop()
+{
+    // requests are taken every round, the transport waits until a datagram
+    // arrives or ControlLink wakes it, timeouts and Qt events once per tick
+    QElapsedTimer clock;
+    clock.start();
+    qint64 nextTickNs = 0;
+    while (!QThread::currentThread()->isInterruptionRequested()) {
+        processRequests();
+        _batchTransfer->waitForPacket(_batchPolling ? 1 : BATCH_IDLE_WAIT);
+        if (clock.nsecsElapsed() >= nextTickNs) {
+            nextTickNs = clock.nsecsElapsed() + BATCH_TICK;
+            _batchPolling = (pollBoards() > 0);
+            QCoreApplication::processEvents();
+        }
+    }
+}
+
+void LinkWorker::processRequests()
+{
+    _wakePending.store(false);
+
+    // scheduled writes are due now, they go out first
+    processSchedule();
+
+    LinkRequest &request = _request;
+    bool taken = false;
+    while (_requestQueue.pop(request)) {
+        taken = true;
+        quint32 tag = request.tag;
+        RegisterAccess *board = ((request.board >= 0) && (request.board < LINK_MAX_BOARDS)) ? _boards[request.board] : nullptr;
+        int error = AUDIO_SUCCESS;
+        if (board == nullptr) {
+            error = AUDIO_BOARD_ERROR;
+        } else if (request.read) {
+            error = board->readAsync(request.address, request.length, [this, tag](int readError, const quint32 *data, int length) {
+                pushResult(tag, readError, data, length);
+            });
+        } else {
+            // the vector keeps its capacity, resizing does not allocate
+            _writeVector.resize(request.length);
+            for (int word=0; word<request.length; word++) {
+                _writeVector[word] = request.data[word];
+            }
+            error = board->writeAsync(request.address, _writeVector, [this, tag](int writeError) {
+                pushResult(tag, writeError, nullptr, 0);
+            });
+        }
+        if (error != AUDIO_SUCCESS) {
+            pushResult(tag, error, nullptr, 0);
+        }
+    }
+
+    // timeouts and the request windows are served by the poll timer, the
+    // batch loop polls on its ticks
+    if (_batchTransfer != nullptr) {
+        _batchPolling = _batchPolling || taken;
+    } else if (!_pollTimer->isActive()) {
+        _pollTimer->start();
+    }
+}
+
+void LinkWorker::processSchedule()
+{
+    LinkRequest &request = _request;
+    while (_schedule.queue.pop(request)) {
+        RegisterAccess *board = ((request.board >= 0) && (request.board < LINK_MAX_BOARDS)) ? _boards[request.board] : nullptr;
+        if (board == nullptr) {
+            _schedule.errors.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+        _writeVector.resize(request.length);
+        for (int word=0; word<request.length; word++) {
+            _writeVector[word] = request.data[word];
+        }
+        // the jitter is recorded by the transport when the datagram leaves,
+        // it may wait behind queued reads or for the next flush()
+        int error = board->writeScheduled(request.address, _writeVector, request.deadline, [this](int writeError) {
+            if (writeError != AUDIO_SUCCESS) {
+                _schedule.errors.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+        if (error != AUDIO_SUCCESS) {
+            _schedule.errors.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+QString LinkWorker::getAddress()
+{
+    return _transfer->getAddress();
+}
+
+quint16 LinkWorker::getPort()
+{
+    return _transfer->getPort();
+}
+
+bool LinkWorker::setAddress(QString address)
+{
+    return _transfer->setAddress(address);
+}
+
+bool LinkWorker::setPort(quint16 port)
+{
+    return _transfer->setPort(port);
+}
+
+int LinkWorker::addBoard(QString address)
+{
+    int peer = _transfer->addPeer(address);
+    if (peer >= LINK_MAX_BOARDS) {
+        _transfer->removePeer(peer);
+        return -1;
+    }
+    _boards[peer] = new RegisterAccess(*_transfer, peer, this);
+    _boards[peer]->setRoundTripHistogram(&_metrics.roundTrip);
+    return peer;
+}
+
+void LinkWorker::removeBoard(int board)
+{
+    // board 0 follows the settings address and is never removed
+    if ((board <= 0) || (board >= LINK_MAX_BOARDS) || (_boards[board] == nullptr)) {
+        return;
+    }
+    _boards[board]->cancelRequests(AUDIO_BOARD_ERROR);
+    delete _boards[board];
+    _boards[board] = nullptr;
+    _transfer->removePeer(board);
+
+    LinkStatistics &statistics = _statistics[board];
+    statistics.requests.store(0);
+    statistics.responses.store(0);
+    statistics.timeouts.store(0);
+    statistics.latePackets.store(0);
+    statistics.roundTripTime.store(0);
+    statistics.timeout.store(0);
+    statistics.retransmits.store(0);
+    statistics.pending.store(0);
+    statistics.orphanedPackets.store(0);
+    statistics.formatErrors.store(0);
+    statistics.sentBytes.store(0);
+    statistics.receivedBytes.store(0);
+}
+
+bool LinkWorker::setBoardAddress(int board, QString address)
+{
+    if ((board < 0) || (board >= LINK_MAX_BOARDS) || (_boards[board] == nullptr)) {
+        return false;
+    }
+    if (board == 0) {
+        return _transfer->setAddress(address);
+    }
+    return _transfer->setPeerAddress(board, address);
+}
+
+bool LinkWorker::startScan()
+{
+    // false if a scan is running or there is no subnet to scan
+    return _scanner->start() > 0;
+}
+
+void LinkWorker::onScanFinished()
+{
+    _scan.mutex.lock();
+    _scan.results = _scanner->getResults();
+    _scan.mutex.unlock();
+    emit scanFinished();
+}
+
+void LinkWorker::onPollTimer()
+{
+    if (pollBoards() == 0) {
+        _pollTimer->stop();
+    }
+}
+
+int LinkWorker::pollBoards()
+{
+    // one timer serves all boards, no thread or timer per board
+    int pending = 0;
+    foreach (RegisterAccess *board, _boards) {
+        if (board != nullptr) {
+            board->poll(0);
+            pending += board->getPendingRequests();
+        }
+    }
+    publishStatistics();
+    return pending;
+}
+
+void LinkWorker::publishStatistics()
+{
+    for (int index=0; index<LINK_MAX_BOARDS; index++) {
+        RegisterAccess *board = _boards[index];
+        if (board == nullptr) {
+            continue;
+        }
+        LinkStatistics &statistics = _statistics[index];
+        statistics.requests.store(board->getRequestCount(), std::memory_order_relaxed);
+        statistics.responses.store(board->getResponseCount(), std::memory_order_relaxed);
+        statistics.timeouts.store(board->getTimeoutCount(), std::memory_order_relaxed);
+        statistics.latePackets.store(_transfer->getLatePackets(index), std::memory_order_relaxed);
+        statistics.roundTripTime.store(board->getRoundTripTime(), std::memory_order_relaxed);
+        statistics.timeout.store(board->getCurrentTimeout(), std::memory_order_relaxed);
+        statistics.retransmits.store(board->getRetransmitCount(), std::memory_order_relaxed);
+        statistics.pending.store(board->getPendingRequests(), std::memory_order_relaxed);
+        statistics.orphanedPackets.store(_transfer->getOrphanedPackets(index), std::memory_order_relaxed);
+        statistics.formatErrors.store(board->getFormatErrorCount(), std::memory_order_relaxed);
+        statistics.sentBytes.store(_transfer->getSentBytes(index), std::memory_order_relaxed);
+        statistics.receivedBytes.store(_transfer->getReceivedBytes(index), std::memory_order_relaxed);
+    }
+    _metrics.unknownPackets.store(_transfer->getUnknownPackets(), std::memory_order_relaxed);
+    _metrics.droppedPackets.store(_transfer->getDroppedPackets(), std::memory_order_relaxed);
+    _metrics.receiveBacklog.store(_transfer->getReceiveBacklog(), std::memory_order_relaxed);
+}
+
+void LinkWorker::pushResult(quint32 tag, int error, const quint32 *data, int length)
+{
+    // ControlLink never has more requests outstanding than the queue holds
+    _result.tag = tag;
+    _result.error = error;
+    _result.length = length;
+    for (int word=0; word<length; word++) {
+        _result.data[word] = data[word];
+    }
+    _resultQueue.push(_result);
+}
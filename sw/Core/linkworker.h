@@ -0,0 +1,169 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : linkworker.h
+// Changelog : 17.10.2026 - file created
+//             17.10.2026 - multiple boards
+//             17.10.2026 - request data inline
+//             17.10.2026 - retransmission statistics
+//             17.10.2026 - scheduled writes
+//             17.10.2026 - link metrics
+//             17.10.2026 - board scan
+//             17.10.2026 - batched linux transport
+//             18.10.2026 - jitter recorded at the send time
+//------------------------------------------------------------------------------
+
+#ifndef LINKWORKER_H
+#define LINKWORKER_H
+
+#include <QObject>
+#include <QTimer>
+#include <QVector>
+#include <QMutex>
+#include <atomic>
+
+#include "spscqueue.h"
+#include "latencyhistogram.h"
+#include "datagramtransfer.h"
+#include "registeraccess.h"
+#include "boardscanner.h"
+#include "typedefinitions.h"
+
+// the data is stored inline, passing requests and results between the
+// threads does not allocate
+struct LinkRequest {
+    quint32 tag;
+    int     board;
+    bool    read;
+    quint32 address;
+    int     length;
+    qint64  deadline;   // ns of std::chrono::steady_clock, scheduled writes only
+    quint32 data[MAX_TRANSFER_WORDS];
+};
+
+struct LinkResult {
+    quint32 tag;
+    int     error;
+    int     length;
+    quint32 data[MAX_TRANSFER_WORDS];
+};
+
+// written by the I/O thread, read by the GUI thread
+struct LinkStatistics {
+    std::atomic<quint32> requests;
+    std::atomic<quint32> responses;
+    std::atomic<quint32> timeouts;
+    std::atomic<quint32> latePackets;
+    std::atomic<quint32> roundTripTime;   // smoothed, in us
+    std::atomic<quint32> timeout;         // current retransmission timeout, in us
+    std::atomic<quint32> retransmits;
+    std::atomic<int>     pending;
+    std::atomic<quint32> orphanedPackets;
+    std::atomic<quint32> formatErrors;      // wrong type or length
+    std::atomic<quint64> sentBytes;
+    std::atomic<quint64> receivedBytes;
+};
+
+// values of the whole link, written by the I/O thread as well
+struct LinkMetrics {
+    LatencyHistogram     roundTrip;
+    std::atomic<quint32> unknownPackets;
+    std::atomic<quint32> droppedPackets;
+    std::atomic<quint32> receiveBacklog;    // most datagrams drained at once
+};
+
+// socket backend of the link, LINK_TRANSPORT_BATCH is only available on linux
+enum LinkTransport {
+    LINK_TRANSPORT_QT,      // QUdpSocket served by the Qt event loop
+    LINK_TRANSPORT_BATCH    // sendmmsg/recvmmsg served by an epoll loop
+};
+
+static const unsigned int LINK_QUEUE_SIZE = 1024;
+static const int          LINK_MAX_BOARDS = 256;
+
+typedef SpscQueue<LinkRequest, LINK_QUEUE_SIZE> LinkRequestQueue;
+typedef SpscQueue<LinkResult, LINK_QUEUE_SIZE>  LinkResultQueue;
+
+static const unsigned int LINK_SCHEDULE_SIZE = 256;
+
+// writes of a scheduler thread, e.g. the automation, they have no callback.
+// the transport compares the time their datagram left with the deadline
+struct LinkSchedule {
+    SpscQueue<LinkRequest, LINK_SCHEDULE_SIZE> queue;
+    LatencyHistogram                           jitter;
+    std::atomic<quint32>                       errors;
+};
+
+// boards found by the last scan, copied when the scan is done
+struct LinkScan {
+    QMutex                          mutex;
+    QVector<BoardScanner::Result>   results;
+};
+
+class BatchTransfer;
+
+// owns the network stack, lives in the I/O thread of ControlLink
+// all boards share one socket, board n talks to peer n of the transport
+//
+// with the batch transport the thread runs an epoll loop instead of the Qt
+// event loop, calls of ControlLink and the board scan are served once per
+// poll tick in between
+class LinkWorker : public QObject
+{
+    Q_OBJECT
+
+public:
+    LinkWorker(LinkRequestQueue &requestQueue, LinkResultQueue &resultQueue, LinkSchedule &schedule,
+               std::atomic<bool> &wakePending, LinkStatistics *statistics, LinkMetrics &metrics,
+               LinkScan &scan, LinkTransport transport);
+
+    void wake();
+
+public slots:
+    void    start();
+    void    processRequests();
+    QString getAddress();
+    quint16 getPort();
+    bool    setAddress(QString address);
+    bool    setPort(quint16 port);
+    int     addBoard(QString address);
+    void    removeBoard(int board);
+    bool    setBoardAddress(int board, QString address);
+    bool    startScan();
+
+signals:
+    void scanFinished();
+
+private slots:
+    void onPollTimer();
+    void onScanFinished();
+    void runBatchLoop();
+
+private:
+    static const int BATCH_TICK      = 1000000;   // ns between the timeouts and Qt events
+    static const int BATCH_IDLE_WAIT = 10;        // ms without outstanding requests
+
+    void processSchedule();
+    void pushResult(quint32 tag, int error, const quint32 *data, int length);
+    int  pollBoards();
+    void publishStatistics();
+
+    LinkRequestQueue          &_requestQueue;
+    LinkResultQueue           &_resultQueue;
+    LinkSchedule              &_schedule;
+    std::atomic<bool>         &_wakePending;
+    LinkStatistics            *_statistics;
+    LinkMetrics               &_metrics;
+    LinkScan                  &_scan;
+    DatagramTransfer          *_transfer;
+    BatchTransfer             *_batchTransfer;
+    BoardScanner              *_scanner;
+    QVector<RegisterAccess *> _boards;
+    QTimer                    *_pollTimer;
+    bool                      _batchPolling;    // requests outstanding, the loop waits 1 ms at most
+    QVector<quint32>          _writeVector;
+    LinkRequest               _request;
+    LinkResult                _result;
+};
+
+#endif // LINKWORKER_H
@@ -0,0 +1,180 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : meterballistics.cpp
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#include "meterballistics.h"
+#include <QtMath>
+
+namespace {
+    // below this difference the needle has arrived
+    const double settledDb = 0.01;
+
+    double toLinear(double levelDb)
+    {
+        return qPow(10.0, levelDb/20.0);
+    }
+
+    double fromLinear(double level)
+    {
+        double floor = MeterBallistics::FLOOR_DB;
+        return (level > 0.0) ? qMax(floor, 20.0*std::log10(level)) : floor;
+    }
+}
+
+MeterBallistics::MeterBallistics(Type type) :
+    _holdMs(0),
+    _holdDecayDbPerSecond(0.0)
+{
+    setType(type);
+    reset();
+}
+
+void MeterBallistics::setType(Type type)
+{
+    // the rise is an exponential on the linear level, the time constants
+    // give the level the standards ask for after a 10 ms tone burst
+    _type = type;
+    switch (type) {
+        case TYPE_PPM_I :
+            _attackMs = 4.5;
+            _releaseDbPerSecond = 20.0 / 1.5;
+            break;
+        case TYPE_PPM_II :
+            _attackMs = 6.3;
+            _releaseDbPerSecond = 24.0 / 2.8;
+            break;
+        case TYPE_VU :
+            // the board delivers peaks, the vu is an approximation on them
+            _attackMs = 300.0 / qLn(100.0);
+            _releaseDbPerSecond = 0.0;
+            break;
+        default :
+            _attackMs = 0.0;
+            _releaseDbPerSecond = 20.0 / 1.7;
+    }
+}
+
+MeterBallistics::Type MeterBallistics::getType()
+{
+    return _type;
+}
+
+void MeterBallistics::setPeakHold(int holdMs, double decayDbPerSecond)
+{
+    // a decay of 0 drops the hold to the level once the time is over
+    _holdMs = holdMs;
+    _holdDecayDbPerSecond = decayDbPerSecond;
+    _holdDb = _levelDb;
+}
+
+void MeterBallistics::reset()
+{
+    _targetDb = FLOOR_DB;
+    _levelDb = FLOOR_DB;
+    _holdDb = FLOOR_DB;
+    _holdTimeMs = 0;
+    _timeMs = 0;
+    _timeValid = false;
+}
+
+double MeterBallistics::toDb(unsigned int level)
+{
+    if (level >= 200) {
+        return FLOOR_DB;
+    }
+    return -static_cast<double>(level)/2;
+}
+
+void MeterBallistics::addReading(unsigned int level, qint64 timeMs)
+{
+    // the movement up to the reading follows the previous target
+    advance(timeMs);
+    _targetDb = toDb(level);
+    if (_attackMs <= 0.0) {
+        advanceLevel(0.0);
+        advanceHold(timeMs);
+    }
+}
+
+void MeterBallistics::advance(qint64 timeMs)
+{
+    if (!_timeValid) {
+        _timeMs = timeMs;
+        _holdTimeMs = timeMs;
+        _timeValid = true;
+    }
+    // readings and frames use the same clock, an older time is ignored
+    if (timeMs < _timeMs) {
+        return;
+    }
+    advanceLevel(static_cast<double>(timeMs - _timeMs));
+    _timeMs = timeMs;
+    advanceHold(timeMs);
+}
+
+void MeterBallistics::advanceLevel(double elapsedMs)
+{
+    if (_targetDb > _levelDb) {
+        if (_attackMs <= 0.0) {
+            _levelDb = _targetDb;
+        } else {
+            double target = toLinear(_targetDb);
+            double level = toLinear(_levelDb);
+            _levelDb = fromLinear(target + (level - target)*qExp(-elapsedMs/_attackMs));
+        }
+    } else if (_targetDb < _levelDb) {
+        if (_releaseDbPerSecond <= 0.0) {
+            double target = toLinear(_targetDb);
+            double level = toLinear(_levelDb);
+            _levelDb = fromLinear(target + (level - target)*qExp(-elapsedMs/_attackMs));
+        } else {
+            _levelDb = qMax(_targetDb, _levelDb - _releaseDbPerSecond*elapsedMs/1000.0);
+        }
+    }
+    if (qAbs(_levelDb - _targetDb) < settledDb) {
+        _levelDb = _targetDb;
+    }
+}
+
+void MeterBallistics::advanceHold(qint64 timeMs)
+{
+    if (_holdMs <= 0) {
+        _holdDb = _levelDb;
+        return;
+    }
+    if (_levelDb >= _holdDb) {
+        _holdDb = _levelDb;
+        _holdTimeMs = timeMs;
+        return;
+    }
+    qint64 expiredMs = timeMs - (_holdTimeMs + _holdMs);
+    if (expiredMs <= 0) {
+        return;
+    }
+    if (_holdDecayDbPerSecond <= 0.0) {
+        _holdDb = _levelDb;
+    } else {
+        // the decay starts at the end of the hold time, it is restarted
+        // from there on every frame
+        _holdDb = qMax(_levelDb, _holdDb - _holdDecayDbPerSecond*expiredMs/1000.0);
+        _holdTimeMs = timeMs - _holdMs;
+    }
+}
+
+bool MeterBallistics::isMoving()
+{
+    return (_levelDb != _targetDb) || (_holdDb != _levelDb);
+}
+
+double MeterBallistics::getLevelDb()
+{
+    return _levelDb;
+}
+
+double MeterBallistics::getHoldDb()
+{
+    return _holdDb;
+}
@@ -0,0 +1,64 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : meterballistics.h
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#ifndef METERBALLISTICS_H
+#define METERBALLISTICS_H
+
+#include <QtGlobal>
+
+// time based needle movement for the peak levels read from meter.vhd
+//
+// every reading is stamped with the time it arrived and becomes the target
+// the display moves to. advance() is called with the time of the frame, so
+// between two polls the needle keeps moving along the ballistics and the
+// movement does not depend on how often the board is polled
+class MeterBallistics
+{
+
+public:
+    enum Type {
+        TYPE_PEAK,      // immediate attack, 20 dB in 1.7 s return
+        TYPE_PPM_I,     // din 45406, -1 dB after a 10 ms burst, 20 dB in 1.5 s return
+        TYPE_PPM_II,    // iec 60268-10 type II, -2 dB after 10 ms, 24 dB in 2.8 s return
+        TYPE_VU         // 99 % of a step within 300 ms, both directions
+    };
+
+    MeterBallistics(Type type = TYPE_PEAK);
+
+    void   setType(Type type);
+    Type   getType();
+    void   setPeakHold(int holdMs, double decayDbPerSecond);
+    void   addReading(unsigned int level, qint64 timeMs);
+    void   advance(qint64 timeMs);
+    void   reset();
+    bool   isMoving();
+    double getLevelDb();
+    double getHoldDb();
+
+    // register value of meter.vhd, attenuation in 0.5 dB steps
+    static double toDb(unsigned int level);
+
+    static const int FLOOR_DB = -100;
+
+private:
+    void   advanceLevel(double elapsedMs);
+    void   advanceHold(qint64 timeMs);
+
+    Type   _type;
+    double _attackMs;           // time constant of the rise, 0 is immediate
+    double _releaseDbPerSecond; // linear fall in dB, 0 is the same time constant as the rise
+    int    _holdMs;             // 0 disables the peak hold
+    double _holdDecayDbPerSecond;
+    double _targetDb;
+    double _levelDb;
+    double _holdDb;
+    qint64 _holdTimeMs;
+    qint64 _timeMs;
+    bool   _timeValid;
+};
+
+#endif // METERBALLISTICS_H
@@ -0,0 +1,205 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : metricsserver.cpp
+// Changelog : 17.10.2026 - file created
+//             18.10.2026 - blocking error added
+//------------------------------------------------------------------------------
+
+#include <QTcpSocket>
+#include <QStringList>
+#include "metricsserver.h"
+#include "typedefinitions.h"
+
+namespace {
+    // label values of the results, indexed by error code
+    const char *const resultNames[] = {
+        "success", "length", "timeout", "type", "received_length", "packet_length", "data_format",
+        "address_format", "busy", "board", "remote_timeout", "verify", "file", "file_format",
+        "blocking"
+    };
+    static_assert(sizeof(resultNames) / sizeof(resultNames[0]) == AUDIO_ERROR_COUNT,
+                  "a result name is missing");
+
+    void appendHeader(QString &text, QString name, QString type, QString help)
+    {
+        text += QString("# HELP %1 %2\n# TYPE %1 %3\n").arg(name, help, type);
+    }
+
+    void appendValue(QString &text, QString name, QString labels, quint64 value)
+    {
+        text += QString("%1%2 %3\n").arg(name, labels, QString::number(value));
+    }
+
+    // one line per board, the boards are grouped by metric as the format requires
+    template <typename T>
+    void appendBoards(QString &text, QString name, QString type, QString help, const QStringList &labels,
+                      const QVector<ControlLink::BoardHealth> &health, T ControlLink::BoardHealth::*value)
+    {
+        appendHeader(text, name, type, help);
+        for (int index=0; index<health.length(); index++) {
+            appendValue(text, name, labels[index], static_cast<quint64>(health[index].*value));
+        }
+    }
+}
+
+MetricsServer::MetricsServer(DeviceManager &deviceManager, QObject *parent) :
+    QObject(parent),
+    _deviceManager(deviceManager),
+    _server(this)
+{
+    ControlLink &controlLink = _deviceManager.getControlLink();
+    addHistogram("audio_link_round_trip_us", "Round trip time of read requests without retransmission.",
+                 &controlLink.getRoundTrip());
+    addHistogram("audio_schedule_jitter_us", "Send time error of scheduled writes, e.g. the automation.",
+                 &controlLink.getJitter());
+    connect(&_server, SIGNAL(newConnection()), this, SLOT(onNewConnection()));
+}
+
+bool MetricsServer::listen(quint16 port)
+{
+    // never reachable from the network, there is no authentication
+    _server.close();
+    return _server.listen(QHostAddress::LocalHost, port);
+}
+
+void MetricsServer::close()
+{
+    _server.close();
+}
+
+bool MetricsServer::isListening()
+{
+    return _server.isListening();
+}
+
+quint16 MetricsServer::getPort()
+{
+    return _server.serverPort();
+}
+
+void MetricsServer::addHistogram(QString name, QString help, LatencyHistogram *histogram)
+{
+    Histogram entry;
+    entry.name = name;
+    entry.help = help;
+    entry.histogram = histogram;
+    _histograms.append(entry);
+}
+
+QString MetricsServer::getText()
+{
+    int count = _deviceManager.getSessionCount();
+    QVector<ControlLink::BoardHealth> health(count);
+    QStringList labels;
+    for (int index=0; index<count; index++) {
+        BoardSession *session = _deviceManager.getSession(index);
+        session->getHealth(health[index]);
+        labels.append(QString("{board=\"%1\",address=\"%2\"}").arg(session->getBoard()).arg(session->getAddress()));
+    }
+
+    QString text;
+    appendBoards(text, "audio_link_requests_total", "counter", "Read requests sent.",
+                 labels, health, &ControlLink::BoardHealth::requests);
+    appendBoards(text, "audio_link_responses_total", "counter", "Read responses received.",
+                 labels, health, &ControlLink::BoardHealth::responses);
+    appendBoards(text, "audio_link_timeouts_total", "counter", "Read requests failed after all retries.",
+                 labels, health, &ControlLink::BoardHealth::timeouts);
+    appendBoards(text, "audio_link_retransmits_total", "counter", "Read requests sent again.",
+                 labels, health, &ControlLink::BoardHealth::retransmits);
+    appendBoards(text, "audio_link_late_responses_total", "counter", "Responses received after the timeout.",
+                 labels, health, &ControlLink::BoardHealth::latePackets);
+    appendBoards(text, "audio_link_orphaned_responses_total", "counter", "Duplicate or unexpected responses.",
+                 labels, health, &ControlLink::BoardHealth::orphanedPackets);
+    appendBoards(text, "audio_link_format_errors_total", "counter", "Responses with wrong type or length.",
+                 labels, health, &ControlLink::BoardHealth::formatErrors);
+    appendBoards(text, "audio_link_sent_bytes_total", "counter", "UDP payload sent.",
+                 labels, health, &ControlLink::BoardHealth::sentBytes);
+    appendBoards(text, "audio_link_received_bytes_total", "counter", "UDP payload received.",
+                 labels, health, &ControlLink::BoardHealth::receivedBytes);
+    appendBoards(text, "audio_link_pending_requests", "gauge", "Requests waiting or in flight.",
+                 labels, health, &ControlLink::BoardHealth::pending);
+    appendBoards(text, "audio_link_smoothed_round_trip_us", "gauge", "Smoothed round trip time.",
+                 labels, health, &ControlLink::BoardHealth::roundTripTime);
+    appendBoards(text, "audio_link_retransmission_timeout_us", "gauge", "Current retransmission timeout.",
+                 labels, health, &ControlLink::BoardHealth::timeout);
+
+    ControlLink &controlLink = _deviceManager.getControlLink();
+    ControlLink::LinkHealth linkHealth;
+    controlLink.getLinkHealth(linkHealth);
+    appendHeader(text, "audio_link_unknown_packets_total", "counter", "Packets from an address that is no board.");
+    appendValue(text, "audio_link_unknown_packets_total", QString(), linkHealth.unknownPackets);
+    appendHeader(text, "audio_link_dropped_packets_total", "counter", "Packets too large or not readable.");
+    appendValue(text, "audio_link_dropped_packets_total", QString(), linkHealth.droppedPackets);
+    appendHeader(text, "audio_link_receive_backlog", "gauge", "Most datagrams waiting in the socket at once.");
+    appendValue(text, "audio_link_receive_backlog", QString(), linkHealth.receiveBacklog);
+    appendHeader(text, "audio_link_results_total", "counter", "Completed and rejected requests by result.");
+    for (int error=0; error<AUDIO_ERROR_COUNT; error++) {
+        appendValue(text, "audio_link_results_total", QString("{result=\"%1\"}").arg(resultNames[error]),
+                    controlLink.getErrorCount(error));
+    }
+    appendHeader(text, "audio_schedule_errors_total", "counter", "Scheduled writes not sent.");
+    appendValue(text, "audio_schedule_errors_total", QString(), controlLink.getScheduleErrors());
+
+    foreach (const Histogram &histogram, _histograms) {
+        appendHistogram(text, histogram);
+    }
+    return text;
+}
+
+void MetricsServer::appendHistogram(QString &text, const Histogram &histogram)
+{
+    // percentiles are upper bucket edges, an upper bound of the latency
+    static const double quantiles[] = {0.5, 0.9, 0.99};
+    static const int    quantileCount = sizeof(quantiles) / sizeof(quantiles[0]);
+
+    LatencyHistogram *values = histogram.histogram;
+    appendHeader(text, histogram.name, "summary", histogram.help);
+    for (int index=0; index<quantileCount; index++) {
+        appendValue(text, histogram.name, QString("{quantile=\"%1\"}").arg(quantiles[index]),
+                    static_cast<quint64>(values->getPercentile(quantiles[index] * 100.0)));
+    }
+    appendValue(text, histogram.name + "_count", QString(), values->getCount());
+    appendHeader(text, histogram.name + "_max", "gauge", "Largest value of " + histogram.name + ".");
+    appendValue(text, histogram.name + "_max", QString(), static_cast<quint64>(values->getMax()));
+}
+
+void MetricsServer::onNewConnection()
+{
+    while (_server.hasPendingConnections()) {
+        QTcpSocket *socket = _server.nextPendingConnection();
+        connect(socket, SIGNAL(readyRead()), this, SLOT(onReadyRead()));
+        connect(socket, SIGNAL(disconnected()), socket, SLOT(deleteLater()));
+    }
+}
+
+void MetricsServer::onReadyRead()
+{
+    QTcpSocket *socket = qobject_cast<QTcpSocket *>(sender());
+    if (socket == nullptr) {
+        return;
+    }
+    // already answered, the rest of the request is not needed
+    if (socket->state() != QAbstractSocket::ConnectedState) {
+        socket->readAll();
+        return;
+    }
+    if (!socket->canReadLine()) {
+        if (socket->bytesAvailable() > MAX_REQUEST_SIZE) {
+            socket->abort();
+        }
+        return;
+    }
+
+    // the whole request is read, a close with unread data resets the connection
+    QByteArray request = socket->readAll();
+    QByteArray body = getText().toUtf8();
+    if (request.startsWith("GET ")) {
+        socket->write("HTTP/1.0 200 OK\r\n"
+                      "Content-Type: text/plain; version=0.0.4\r\n"
+                      "Content-Length: " + QByteArray::number(body.size()) + "\r\n"
+                      "Connection: close\r\n\r\n");
+    }
+    socket->write(body);
+    socket->disconnectFromHost();
+}
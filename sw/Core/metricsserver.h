@@ -0,0 +1,62 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : metricsserver.h
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#ifndef METRICSSERVER_H
+#define METRICSSERVER_H
+
+#include <QObject>
+#include <QTcpServer>
+#include <QVector>
+
+#include "devicemanager.h"
+#include "latencyhistogram.h"
+
+// text endpoint with the counters and latencies of the control stack
+//
+// listens on the loopback interface only. every connection gets the current
+// values in the prometheus text format and is closed, a http GET is answered
+// with a http header, anything else, e.g. a line sent with nc, with the plain
+// text. nothing is collected here, the values are read when they are asked
+// for so the polling path only pays for its counters
+class MetricsServer : public QObject
+{
+    Q_OBJECT
+
+public:
+    static const int DEFAULT_PORT = 9464;
+
+    explicit MetricsServer(DeviceManager &deviceManager, QObject *parent = nullptr);
+
+    bool    listen(quint16 port);
+    void    close();
+    bool    isListening();
+    quint16 getPort();
+    void    addHistogram(QString name, QString help, LatencyHistogram *histogram);
+    QString getText();
+
+private slots:
+    void onNewConnection();
+    void onReadyRead();
+
+private:
+    struct Histogram {
+        QString          name;
+        QString          help;
+        LatencyHistogram *histogram;
+    };
+
+    static const int MAX_REQUEST_SIZE = 4096;
+
+    void appendHistogram(QString &text, const Histogram &histogram);
+
+    DeviceManager      &_deviceManager;
+    QTcpServer         _server;
+    QVector<Histogram> _histograms;
+
+};
+
+#endif // METRICSSERVER_H
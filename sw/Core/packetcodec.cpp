@@ -0,0 +1,92 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : packetcodec.cpp
+// Changelog : 17.10.2026 - file created
+//             17.10.2026 - remote timeout error
+//------------------------------------------------------------------------------
+
+#include "packetcodec.h"
+#include "typedefinitions.h"
+
+int PacketCodec::encodeRead(char *packet, quint8 id, quint32 address, int length)
+{
+    // length in words, the packet carries bytes
+    return encodeHeader(packet, id, UDP_READ, address, length*REGISTER_SIZE);
+}
+
+int PacketCodec::encodeWrite(char *packet, quint8 id, quint32 address, const quint32 *data, int length)
+{
+    int size = encodeHeader(packet, id, UDP_WRITE, address, length*REGISTER_SIZE);
+    storeWords(packet + size, data, length);
+    return size + length*REGISTER_SIZE;
+}
+
+int PacketCodec::decodeReadResponse(const char *packet, int size, quint32 *data, int length)
+{
+    if (size < RESPONSE_HEADER_SIZE) {
+        return AUDIO_PACKET_LENGTH_ERROR;
+    }
+    if (packet[1] == UDP_READ_TIMEOUT) {
+        // the register bank did not answer in time, no need to wait any longer
+        return AUDIO_REMOTE_TIMEOUT_ERROR;
+    }
+    if (packet[1] != UDP_READ_RESPONSE) {
+        return AUDIO_TYPE_ERROR;
+    }
+    int receiveLength = (static_cast<quint8>(packet[2])<<8) | static_cast<quint8>(packet[3]);
+    if (receiveLength != length*REGISTER_SIZE) {
+        return AUDIO_RECEIVED_LENGTH_ERROR;
+    }
+    if (receiveLength > (size-RESPONSE_HEADER_SIZE)) {
+        return AUDIO_PACKET_LENGTH_ERROR;
+    }
+    loadWords(data, packet + RESPONSE_HEADER_SIZE, length);
+
+    return AUDIO_SUCCESS;
+}
+
+quint8 PacketCodec::getId(const char *packet)
+{
+    return static_cast<quint8>(packet[0]);
+}
+
+void PacketCodec::storeWords(char *destination, const quint32 *source, int count)
+{
+    // plain shifts, the compiler turns the loop into byte swaps
+    uchar *byte = reinterpret_cast<uchar *>(destination);
+    for (int word=0; word<count; word++) {
+        quint32 value = source[word];
+        byte[0] = static_cast<uchar>(value>>24);
+        byte[1] = static_cast<uchar>(value>>16);
+        byte[2] = static_cast<uchar>(value>>8);
+        byte[3] = static_cast<uchar>(value);
+        byte += REGISTER_SIZE;
+    }
+}
+
+void PacketCodec::loadWords(quint32 *destination, const char *source, int count)
+{
+    const uchar *byte = reinterpret_cast<const uchar *>(source);
+    for (int word=0; word<count; word++) {
+        destination[word] = (static_cast<quint32>(byte[0])<<24) |
+                            (static_cast<quint32>(byte[1])<<16) |
+                            (static_cast<quint32>(byte[2])<<8) |
+                             static_cast<quint32>(byte[3]);
+        byte += REGISTER_SIZE;
+    }
+}
+
+int PacketCodec::encodeHeader(char *packet, quint8 id, char command, quint32 address, int length)
+{
+    packet[0] = static_cast<char>(id);
+    packet[1] = command;
+    packet[2] = ADDRESS_SIZE;
+    packet[3] = static_cast<char>((address>>24) & 0xff);
+    packet[4] = static_cast<char>((address>>16) & 0xff);
+    packet[5] = static_cast<char>((address>>8) & 0xff);
+    packet[6] = static_cast<char>(address & 0xff);
+    packet[7] = static_cast<char>((length>>8) & 0xff);
+    packet[8] = static_cast<char>(length & 0xff);
+    return REQUEST_HEADER_SIZE;
+}
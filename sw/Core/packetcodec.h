@@ -0,0 +1,42 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : packetcodec.h
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#ifndef PACKETCODEC_H
+#define PACKETCODEC_H
+
+#include <QtGlobal>
+
+// encoding and decoding of the eth_ctrl register protocol
+//
+// request  : id, command, address size (4), address, length (2), data
+// response : id, command, length (2), data
+//
+// address, length and data are big endian, the length is given in bytes.
+// packets are written to and read from caller provided buffers, nothing
+// is allocated
+class PacketCodec
+{
+
+public:
+    static const int ADDRESS_SIZE         = 4;
+    static const int REQUEST_HEADER_SIZE  = 9;
+    static const int RESPONSE_HEADER_SIZE = 4;
+    static const int MAX_PACKET_SIZE      = 1500;
+
+    static int    encodeRead(char *packet, quint8 id, quint32 address, int length);
+    static int    encodeWrite(char *packet, quint8 id, quint32 address, const quint32 *data, int length);
+    static int    decodeReadResponse(const char *packet, int size, quint32 *data, int length);
+    static quint8 getId(const char *packet);
+
+    static void   storeWords(char *destination, const quint32 *source, int count);
+    static void   loadWords(quint32 *destination, const char *source, int count);
+
+private:
+    static int    encodeHeader(char *packet, quint8 id, char command, quint32 address, int length);
+};
+
+#endif // PACKETCODEC_H
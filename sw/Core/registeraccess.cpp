@@ -0,0 +1,480 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 27.12.2018
+// Filename  : registeraccess.cpp
+// Changelog : 27.12.2018 - file created
+//             17.10.2026 - pipelined request engine added
+//             17.10.2026 - event driven response handling
+//             17.10.2026 - peer selection and health statistics
+//             17.10.2026 - allocation free packet handling
+//             17.10.2026 - adaptive timeout and read retransmission
+//             17.10.2026 - round trip histogram and format errors
+//             17.10.2026 - batched transports and kernel timestamps
+//             18.10.2026 - deadline of scheduled writes passed to the transport
+//             18.10.2026 - ids of abandoned reads held back
+//             18.10.2026 - reads with side effects not repeated
+//------------------------------------------------------------------------------
+
+#include "registeraccess.h"
+#include "typedefinitions.h"
+#include "registermap.h"
+
+RegisterAccess::RegisterAccess(DatagramTransfer &transfer, int peer, QObject *parent) :
+    QObject(parent),
+    _transfer(transfer),
+    _peer(peer),
+    _id(0),
+    _windowSize(32),
+    _timeoutMs(100),
+    _maxRetries(2),
+    _inFlightCount(0),
+    _dispatching(false),
+    _waiting(WAIT_QUEUE_SIZE),
+    _waitingHead(0),
+    _waitingTail(0),
+    _requestCount(0),
+    _responseCount(0),
+    _timeoutCount(0),
+    _retransmitCount(0),
+    _formatErrorCount(0),
+    _smoothedRttUs(0),
+    _rttVariationUs(0),
+    _retransmitTimeoutUs(100000),
+    _roundTripHistogram(nullptr)
+{
+    for (int index=0; index<ID_COUNT; index++) {
+        _inFlight[index].active = false;
+        _inFlight[index].released = false;
+    }
+    connect(&_transfer, SIGNAL(packetReceived(int,quint8)), this, SLOT(onPacketReceived(int,quint8)));
+}
+
+RegisterAccess::~RegisterAccess() {}
+
+int RegisterAccess::read(quint32 address, QVector<quint32> &data, int length)
+{
+    int errorCode = AUDIO_TIMEOUT_ERROR;
+    bool done = false;
+    int requestError = readAsync(address, length, [&](int error, const quint32 *readData, int readLength) {
+        errorCode = error;
+        for (int word=0; word<readLength; word++) {
+            data.append(readData[word]);
+        }
+        done = true;
+    });
+    if (requestError != AUDIO_SUCCESS) {
+        return requestError;
+    }
+
+    // every request is either answered or timed out by poll()
+    while (!done) {
+        poll(1);
+    }
+    return errorCode;
+}
+
+int RegisterAccess::write(quint32 address, QVector<quint32> &data)
+{
+    return writeAsync(address, data, nullptr);
+}
+
+int RegisterAccess::readAsync(quint32 address, int length, ReadCallback callback)
+{
+    if (length > MAX_TRANSFER_WORDS) {
+        return AUDIO_LENGTH_ERROR;
+    }
+    if ((_waitingHead - _waitingTail) >= WAIT_QUEUE_SIZE) {
+        return AUDIO_BUSY_ERROR;
+    }
+
+    Request &request = _waiting[_waitingHead % WAIT_QUEUE_SIZE];
+    request.read = true;
+    request.address = address;
+    request.length = length;
+    request.deadlineNs = 0;
+    request.readCallback = callback;
+    _waitingHead++;
+    dispatch();
+
+    return AUDIO_SUCCESS;
+}
+
+int RegisterAccess::writeAsync(quint32 address, const QVector<quint32> &data, WriteCallback callback)
+{
+    return writeScheduled(address, data, 0, callback);
+}
+
+int RegisterAccess::writeScheduled(quint32 address, const QVector<quint32> &data, qint64 deadlineNs, WriteCallback callback)
+{
+    // deadlineNs is the planned send time in ns of std::chrono::steady_clock,
+    // the transport compares it with the time the datagram really left
+    if (data.length() > MAX_TRANSFER_WORDS) {
+        return AUDIO_LENGTH_ERROR;
+    }
+    if ((_waitingHead - _waitingTail) >= WAIT_QUEUE_SIZE) {
+        return AUDIO_BUSY_ERROR;
+    }
+
+    // copy into the buffer of the queue entry, it only allocates the first time
+    Request &request = _waiting[_waitingHead % WAIT_QUEUE_SIZE];
+    request.read = false;
+    request.address = address;
+    request.length = data.length();
+    request.deadlineNs = deadlineNs;
+    request.data.resize(data.length());
+    for (int word=0; word<data.length(); word++) {
+        request.data[word] = data[word];
+    }
+    request.writeCallback = callback;
+    _waitingHead++;
+    dispatch();
+
+    return AUDIO_SUCCESS;
+}
+
+void RegisterAccess::poll(int waitMs)
+{
+    // a batched transport sends the queued datagrams here, responses are
+    // delivered through onPacketReceived() while waiting
+    _transfer.flush();
+    if ((_inFlightCount > 0) && (waitMs > 0)) {
+        _transfer.waitForPacket(waitMs);
+    }
+    processTimeouts();
+    dispatch();
+}
+
+void RegisterAccess::setWindowSize(int windowSize)
+{
+    _windowSize = qBound(1, windowSize, static_cast<int>(ID_COUNT));
+    dispatch();
+}
+
+int RegisterAccess::getWindowSize()
+{
+    return _windowSize;
+}
+
+void RegisterAccess::setTimeout(int timeoutMs)
+{
+    // upper bound of the adaptive timeout and the timeout before the first response
+    _timeoutMs = timeoutMs;
+    if (_responseCount == 0) {
+        _retransmitTimeoutUs = static_cast<qint64>(timeoutMs) * 1000;
+    }
+    _retransmitTimeoutUs = qMin(_retransmitTimeoutUs, static_cast<qint64>(timeoutMs) * 1000);
+}
+
+void RegisterAccess::setMaxRetries(int retries)
+{
+    _maxRetries = qMax(0, retries);
+}
+
+int RegisterAccess::getPendingRequests()
+{
+    return _inFlightCount + static_cast<int>(_waitingHead - _waitingTail);
+}
+
+void RegisterAccess::cancelRequests(int error)
+{
+    // every request gets its callback, e.g. when the board is removed
+    while (_waitingTail != _waitingHead) {
+        Request &request = _waiting[_waitingTail % WAIT_QUEUE_SIZE];
+        _waitingTail++;
+        ReadCallback readCallback = std::move(request.readCallback);
+        WriteCallback writeCallback = std::move(request.writeCallback);
+        request.readCallback = nullptr;
+        request.writeCallback = nullptr;
+        if (request.read && readCallback) {
+            readCallback(error, nullptr, 0);
+        } else if (!request.read && writeCallback) {
+            writeCallback(error);
+        }
+    }
+    for (int id=0; id<ID_COUNT; id++) {
+        InFlight &slot = _inFlight[id];
+        if (slot.active) {
+            ReadCallback callback = std::move(slot.callback);
+            slot.callback = nullptr;
+            slot.active = false;
+            _inFlightCount--;
+            releaseId(static_cast<quint8>(id));
+            if (callback) {
+                callback(error, nullptr, 0);
+            }
+        }
+    }
+}
+
+int RegisterAccess::getPeer()
+{
+    return _peer;
+}
+
+quint32 RegisterAccess::getRequestCount()
+{
+    return _requestCount;
+}
+
+quint32 RegisterAccess::getResponseCount()
+{
+    return _responseCount;
+}
+
+quint32 RegisterAccess::getTimeoutCount()
+{
+    return _timeoutCount;
+}
+
+quint32 RegisterAccess::getRoundTripTime()
+{
+    return static_cast<quint32>(_smoothedRttUs);
+}
+
+quint32 RegisterAccess::getRoundTripVariation()
+{
+    return static_cast<quint32>(_rttVariationUs);
+}
+
+quint32 RegisterAccess::getCurrentTimeout()
+{
+    return static_cast<quint32>(_retransmitTimeoutUs);
+}
+
+quint32 RegisterAccess::getRetransmitCount()
+{
+    return _retransmitCount;
+}
+
+quint32 RegisterAccess::getFormatErrorCount()
+{
+    return _formatErrorCount;
+}
+
+void RegisterAccess::resetStatistics()
+{
+    _requestCount = 0;
+    _responseCount = 0;
+    _timeoutCount = 0;
+    _retransmitCount = 0;
+    _formatErrorCount = 0;
+}
+
+void RegisterAccess::setRoundTripHistogram(LatencyHistogram *histogram)
+{
+    // shared by all boards of a link, they are served by the same thread
+    _roundTripHistogram = histogram;
+}
+
+void RegisterAccess::dispatch()
+{
+    // callbacks may queue new requests, the outer loop picks them up
+    if (_dispatching) {
+        return;
+    }
+    _dispatching = true;
+
+    while (_waitingTail != _waitingHead) {
+        Request &request = _waiting[_waitingTail % WAIT_QUEUE_SIZE];
+        if (request.read) {
+            // the id sequence is shared by reads and writes, stop if no
+            // id is free
+            if ((_inFlightCount >= _windowSize) || !takeId()) {
+                break;
+            }
+            _waitingTail++;
+            InFlight &slot = _inFlight[_id];
+            slot.active = true;
+            slot.address = request.address;
+            slot.length = request.length;
+            slot.retries = 0;
+            slot.repeatable = true;
+            for (int word=0; word<slot.length; word++) {
+                slot.repeatable = slot.repeatable &&
+                                  RegisterMap::isSideEffectFree(slot.address + static_cast<quint32>(word*REGISTER_SIZE));
+            }
+            slot.deadlineUs = _retransmitTimeoutUs;
+            slot.callback = std::move(request.readCallback);
+            request.readCallback = nullptr;
+            slot.timer.start();
+            _inFlightCount++;
+            _requestCount++;
+            _transfer.expectPacket(_peer, _id);
+            sendReadCommand(_id, slot.address, slot.length);
+            _id++;
+        } else {
+            if (!takeId()) {
+                break;
+            }
+            _waitingTail++;
+            WriteCallback callback = std::move(request.writeCallback);
+            request.writeCallback = nullptr;
+            sendWriteCommand(request.address, request.data.constData(), request.length, request.deadlineNs);
+            // writes are not acknowledged by the firmware
+            if (callback) {
+                callback(AUDIO_SUCCESS);
+            }
+        }
+    }
+
+    _dispatching = false;
+}
+
+bool RegisterAccess::takeId()
+{
+    // the response has no address, only the length is checked. an id is
+    // reused only once a late response to an abandoned read can no longer
+    // arrive, it would complete the new request with foreign data
+    for (int count=0; count<ID_COUNT; count++, _id++) {
+        InFlight &slot = _inFlight[_id];
+        if (slot.active) {
+            continue;
+        }
+        if (slot.released) {
+            if (slot.timer.elapsed() < _timeoutMs) {
+                continue;
+            }
+            slot.released = false;
+        }
+        return true;
+    }
+    return false;
+}
+
+void RegisterAccess::releaseId(quint8 id)
+{
+    // the slot is inactive, the id is held back by takeId()
+    InFlight &slot = _inFlight[id];
+    slot.released = true;
+    slot.timer.start();
+    _transfer.releasePacket(_peer, id);
+}
+
+void RegisterAccess::onPacketReceived(int peer, quint8 id)
+{
+    // all boards share one socket
+    if (peer != _peer) {
+        return;
+    }
+    InFlight &slot = _inFlight[id];
+    if (!slot.active) {
+        _transfer.releasePacket(_peer, id);
+        return;
+    }
+    const char *packet = nullptr;
+    int size = 0;
+    if (!_transfer.readPacket(_peer, id, packet, size, 0)) {
+        return;
+    }
+
+    ReadCallback callback = std::move(slot.callback);
+    int length = slot.length;
+    slot.callback = nullptr;
+    slot.active = false;
+    _inFlightCount--;
+    _responseCount++;
+
+    // decoded in place into the read buffer, valid during the callback
+    int errorCode = PacketCodec::decodeReadResponse(packet, size, _readBuffer, length);
+    if ((errorCode == AUDIO_TYPE_ERROR) || (errorCode == AUDIO_RECEIVED_LENGTH_ERROR) ||
+        (errorCode == AUDIO_PACKET_LENGTH_ERROR)) {
+        _formatErrorCount++;
+    }
+
+    // a response to a retransmitted request may belong to any of the copies
+    // and is not used as sample (Karn's algorithm), neither is the timeout
+    // packet of the firmware as it includes the register bank timeout
+    if ((slot.retries == 0) && (errorCode != AUDIO_REMOTE_TIMEOUT_ERROR)) {
+        // the kernel timestamps of the transport leave out the delay until
+        // this thread got the response
+        qint64 sampleNs = _transfer.getRoundTripTime(_peer, id);
+        if (sampleNs <= 0) {
+            sampleNs = slot.timer.nsecsElapsed();
+        }
+        updateRoundTripTime(sampleNs / 1000);
+        if (_roundTripHistogram != nullptr) {
+            _roundTripHistogram->add(sampleNs);
+        }
+    }
+
+    if (callback) {
+        callback(errorCode, _readBuffer, (errorCode == AUDIO_SUCCESS) ? length : 0);
+    }
+
+    // the window has room again
+    dispatch();
+}
+
+void RegisterAccess::processTimeouts()
+{
+    if (_inFlightCount == 0) {
+        return;
+    }
+
+    qint64 maxTimeoutUs = static_cast<qint64>(_timeoutMs) * 1000;
+    for (int id=0; id<ID_COUNT; id++) {
+        InFlight &slot = _inFlight[id];
+        if (!slot.active || ((slot.timer.nsecsElapsed() / 1000) < slot.deadlineUs)) {
+            continue;
+        }
+
+        // reads are repeated with the same id, a late response of an
+        // earlier copy completes the request as well. a meter clears its
+        // peak when read, the copy would return the cleared value, such
+        // reads time out instead
+        if (slot.repeatable && (slot.retries < _maxRetries)) {
+            slot.retries++;
+            _retransmitCount++;
+            qint64 timeoutUs = qMin(_retransmitTimeoutUs << slot.retries, maxTimeoutUs);
+            slot.deadlineUs = (slot.timer.nsecsElapsed() / 1000) + timeoutUs;
+            sendReadCommand(static_cast<quint8>(id), slot.address, slot.length);
+            continue;
+        }
+
+        ReadCallback callback = std::move(slot.callback);
+        slot.callback = nullptr;
+        slot.active = false;
+        _inFlightCount--;
+        _timeoutCount++;
+        releaseId(static_cast<quint8>(id));
+
+        // back off until the next valid sample
+        _retransmitTimeoutUs = qMin(_retransmitTimeoutUs * 2, maxTimeoutUs);
+
+        if (callback) {
+            callback(AUDIO_TIMEOUT_ERROR, nullptr, 0);
+        }
+    }
+}
+
+void RegisterAccess::updateRoundTripTime(qint64 sampleUs)
+{
+    // Jacobson/Karels estimator as used for the tcp retransmission timeout (RFC 6298)
+    if (_smoothedRttUs == 0) {
+        _smoothedRttUs = sampleUs;
+        _rttVariationUs = sampleUs / 2;
+    } else {
+        qint64 delta = qAbs(_smoothedRttUs - sampleUs);
+        _rttVariationUs += (delta - _rttVariationUs) / 4;
+        _smoothedRttUs += (sampleUs - _smoothedRttUs) / 8;
+    }
+    qint64 timeoutUs = _smoothedRttUs + qMax(static_cast<qint64>(CLOCK_GRANULARITY), 4*_rttVariationUs);
+    _retransmitTimeoutUs = qBound(static_cast<qint64>(MIN_TIMEOUT_US), timeoutUs, static_cast<qint64>(_timeoutMs) * 1000);
+}
+
+void RegisterAccess::sendReadCommand(quint8 id, quint32 address, int length)
+{
+    int size = PacketCodec::encodeRead(_sendBuffer, id, address, length);
+    _transfer.sendPacket(_peer, _sendBuffer, size);
+}
+
+quint8 RegisterAccess::sendWriteCommand(quint32 address, const quint32 *data, int length, qint64 deadlineNs)
+{
+    quint8 writeId = _id;
+    _id ++;
+
+    int size = PacketCodec::encodeWrite(_sendBuffer, writeId, address, data, length);
+    _transfer.sendPacket(_peer, _sendBuffer, size, deadlineNs);
+
+    return writeId;
+}
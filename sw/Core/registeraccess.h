@@ -0,0 +1,128 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 27.12.2018
+// Filename  : registeraccess.h
+// Changelog : 27.12.2018 - file created
+//             17.10.2026 - pipelined request engine added
+//             17.10.2026 - event driven response handling
+//             17.10.2026 - peer selection and health statistics
+//             17.10.2026 - allocation free packet handling
+//             17.10.2026 - adaptive timeout and read retransmission
+//             17.10.2026 - round trip histogram and format errors
+//             17.10.2026 - batched transports and kernel timestamps
+//             18.10.2026 - deadline of scheduled writes passed to the transport
+//             18.10.2026 - ids of abandoned reads held back
+//             18.10.2026 - reads with side effects not repeated
+//------------------------------------------------------------------------------
+
+#ifndef REGISTERACCESS_H
+#define REGISTERACCESS_H
+
+#include <QObject>
+#include <QElapsedTimer>
+#include "datagramtransfer.h"
+#include "iregisteraccess.h"
+#include "packetcodec.h"
+#include "latencyhistogram.h"
+#include "typedefinitions.h"
+
+class RegisterAccess : public QObject, public IRegisterAccess
+{
+    Q_OBJECT
+
+public:
+    explicit RegisterAccess(DatagramTransfer &transfer, int peer = 0, QObject *parent = nullptr);
+    ~RegisterAccess() override;
+    int  read(quint32 address, QVector<quint32> &data, int length) override;
+    int  write(quint32 address, QVector<quint32> &data) override;
+    int  readAsync(quint32 address, int length, ReadCallback callback) override;
+    int  writeAsync(quint32 address, const QVector<quint32> &data, WriteCallback callback) override;
+    int  writeScheduled(quint32 address, const QVector<quint32> &data, qint64 deadlineNs, WriteCallback callback);
+    void poll(int waitMs) override;
+
+    void setWindowSize(int windowSize);
+    int  getWindowSize();
+    void setTimeout(int timeoutMs);
+    void setMaxRetries(int retries);
+    int  getPendingRequests();
+    void cancelRequests(int error);
+    int  getPeer();
+
+    quint32 getRequestCount();
+    quint32 getResponseCount();
+    quint32 getTimeoutCount();
+    quint32 getRoundTripTime();
+    quint32 getRoundTripVariation();
+    quint32 getCurrentTimeout();
+    quint32 getRetransmitCount();
+    quint32 getFormatErrorCount();
+    void    resetStatistics();
+    void    setRoundTripHistogram(LatencyHistogram *histogram);
+
+private slots:
+    void onPacketReceived(int peer, quint8 id);
+
+private:
+    struct Request {
+        bool             read;
+        quint32          address;
+        int              length;
+        qint64           deadlineNs;  // scheduled writes only, 0 otherwise
+        QVector<quint32> data;      // keeps its capacity, the queue entries are reused
+        ReadCallback     readCallback;
+        WriteCallback    writeCallback;
+    };
+
+    struct InFlight {
+        bool          active;
+        bool          released;     // abandoned, a late response may still arrive
+        quint32       address;
+        int           length;
+        int           retries;
+        bool          repeatable;   // reading has no side effects
+        qint64        deadlineUs;   // since timer start
+        ReadCallback  callback;
+        QElapsedTimer timer;        // since the request was sent or released
+    };
+
+    static const int ID_COUNT          = 256;
+    static const int WAIT_QUEUE_SIZE   = 256;
+    static const int MIN_TIMEOUT_US    = 2000;
+    static const int CLOCK_GRANULARITY = 1000;   // poll interval of the link worker in us
+
+    void   dispatch();
+    bool   takeId();
+    void   releaseId(quint8 id);
+    void   processTimeouts();
+    void   updateRoundTripTime(qint64 sampleUs);
+    void   sendReadCommand(quint8 id, quint32 address, int length);
+    quint8 sendWriteCommand(quint32 address, const quint32 *data, int length, qint64 deadlineNs);
+
+    DatagramTransfer &_transfer;
+    int              _peer;
+
+    quint8           _id;
+    int              _windowSize;
+    int              _timeoutMs;
+    int              _maxRetries;
+    int              _inFlightCount;
+    bool             _dispatching;
+    InFlight         _inFlight[ID_COUNT];
+    QVector<Request> _waiting;
+    unsigned int     _waitingHead;
+    unsigned int     _waitingTail;
+    char             _sendBuffer[PacketCodec::MAX_PACKET_SIZE];
+    quint32          _readBuffer[MAX_TRANSFER_WORDS];
+    quint32          _requestCount;
+    quint32          _responseCount;
+    quint32          _timeoutCount;
+    quint32          _retransmitCount;
+    quint32          _formatErrorCount;
+    qint64           _smoothedRttUs;
+    qint64           _rttVariationUs;
+    qint64           _retransmitTimeoutUs;
+    LatencyHistogram *_roundTripHistogram;
+
+};
+
+#endif // REGISTERACCESS_H
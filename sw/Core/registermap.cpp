@@ -0,0 +1,137 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : registermap.cpp
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#include <QFile>
+#include <QMap>
+#include <QSet>
+#include <QRegularExpression>
+#include "registermap.h"
+
+namespace {
+    // text of a constant up to its terminating semicolon
+    QString getConstant(const QString &content, QString name)
+    {
+        int start = content.indexOf(QRegularExpression("constant\\s+" + name + "\\s*:"));
+        if (start < 0) {
+            return QString();
+        }
+        int end = content.indexOf(';', start);
+        return content.mid(start, (end < 0) ? -1 : end - start);
+    }
+
+    // register_address_<name>_c => value pairs of an aggregate, others as "others"
+    QMap<QString, QString> getAggregate(const QString &constant, QString value)
+    {
+        QMap<QString, QString> aggregate;
+        QRegularExpression entry("(?:register_address_(\\w+)_c|(others))\\s*=>\\s*" + value);
+        QRegularExpressionMatchIterator match = entry.globalMatch(constant);
+        while (match.hasNext()) {
+            QRegularExpressionMatch element = match.next();
+            QString name = element.captured(1).isEmpty() ? element.captured(2) : element.captured(1);
+            aggregate.insert(name, element.captured(3));
+        }
+        return aggregate;
+    }
+
+    QString toHex(quint32 value)
+    {
+        return "0x" + QString::number(value, 16).rightJustified(8, '0');
+    }
+}
+
+int RegisterMap::check(QString fileName, QStringList &differences)
+{
+    // compares the map with the register_*_c constants of audio_top.vhd
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return AUDIO_FILE_ERROR;
+    }
+    QString content = QString::fromLatin1(file.readAll());
+    // comments could hold old definitions
+    content.remove(QRegularExpression("--[^\n]*"));
+
+    QRegularExpression countEntry("constant\\s+register_count_c\\s*:\\s*\\w+\\s*:=\\s*(\\d+)");
+    QRegularExpressionMatch count = countEntry.match(content);
+    if (!count.hasMatch()) {
+        return AUDIO_FILE_FORMAT_ERROR;
+    }
+    if (count.captured(1).toInt() != REGISTER_COUNT) {
+        differences << QString("register count %1, firmware has %2").arg(REGISTER_COUNT).arg(count.captured(1));
+    }
+
+    QMap<QString, int> indices;
+    QRegularExpression addressEntry("constant\\s+register_address_(\\w+)_c\\s*:\\s*\\w+\\s*:=\\s*(\\d+)");
+    QRegularExpressionMatchIterator match = addressEntry.globalMatch(content);
+    while (match.hasNext()) {
+        QRegularExpressionMatch address = match.next();
+        indices.insert(address.captured(1), address.captured(2).toInt());
+    }
+
+    QMap<QString, QString> readOnly = getAggregate(getConstant(content, "register_read_only_c"), "'([01])'");
+    QMap<QString, QString> masks = getAggregate(getConstant(content, "register_mask_c"), "x\"([0-9a-fA-F]{8})\"");
+    QMap<QString, QString> inits = getAggregate(getConstant(content, "register_init_c"), "x\"([0-9a-fA-F]{8})\"");
+    if (indices.isEmpty() || readOnly.isEmpty() || masks.isEmpty()) {
+        return AUDIO_FILE_FORMAT_ERROR;
+    }
+
+    // a read of these registers strobes the meter peak reset
+    QSet<QString> clearOnRead;
+    QRegularExpression readEntry("register_was_read\\s*\\(\\s*register_address_(\\w+)_c\\s*\\)");
+    match = readEntry.globalMatch(content);
+    while (match.hasNext()) {
+        clearOnRead.insert(match.next().captured(1));
+    }
+
+    const Entry *entries = getEntries();
+    for (int index=0; index<getEntryCount(); index++) {
+        const Entry &entry = entries[index];
+        QString name(entry.name);
+        // host registers must stay free in the firmware, they get the others values
+        QString key = entry.firmware ? name : QString("others");
+        if (entry.firmware && !indices.contains(name)) {
+            differences << name + ": missing in the firmware";
+            continue;
+        }
+        if (!entry.firmware && indices.values().contains(entry.index)) {
+            differences << QString("%1: index %2 is used by the firmware").arg(name).arg(entry.index);
+            continue;
+        }
+        if (entry.firmware && (indices.value(name) != entry.index)) {
+            differences << QString("%1: index %2, firmware has %3").arg(name).arg(entry.index).arg(indices.value(name));
+        }
+        QString flag = readOnly.value(key, readOnly.value("others"));
+        if (flag != (entry.readOnly ? "1" : "0")) {
+            differences << QString("%1: read only %2, firmware has %3").arg(name).arg(entry.readOnly ? 1 : 0).arg(flag);
+        }
+        quint32 mask = masks.value(key, masks.value("others")).toUInt(nullptr, 16);
+        if (mask != entry.mask) {
+            differences << QString("%1: mask %2, firmware has %3").arg(name, toHex(entry.mask), toHex(mask));
+        }
+        if (clearOnRead.contains(name) != entry.clearOnRead) {
+            differences << QString("%1: clear on read %2, firmware has %3").arg(name)
+                           .arg(entry.clearOnRead ? 1 : 0).arg(clearOnRead.contains(name) ? 1 : 0);
+        }
+    }
+
+    // registers the host does not know about
+    foreach (const QString &name, indices.keys()) {
+        bool known = false;
+        for (int index=0; index<getEntryCount(); index++) {
+            known = known || (name == entries[index].name);
+        }
+        if (!known) {
+            differences << QString("%1: index %2 missing in the register map").arg(name).arg(indices.value(name));
+        }
+    }
+
+    quint32 version = inits.value("version").toUInt(nullptr, 16);
+    if (version != VERSION_INIT) {
+        differences << QString("version: init %1, firmware has %2").arg(toHex(VERSION_INIT), toHex(version));
+    }
+
+    return AUDIO_SUCCESS;
+}
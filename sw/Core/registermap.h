@@ -0,0 +1,203 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : registermap.h
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#ifndef REGISTERMAP_H
+#define REGISTERMAP_H
+
+#include <QVector>
+#include <QStringList>
+
+#include "iregisteraccess.h"
+#include "typedefinitions.h"
+
+// one register of the register bank of audio_top.vhd
+//
+// the properties are compile time constants, wrong accesses such as a write
+// to a read only register are rejected by the compiler
+template <int INDEX, quint32 MASK, bool READ_ONLY, bool CLEAR_ON_READ>
+class Register
+{
+    static_assert((INDEX >= 0) && (INDEX < REGISTER_COUNT), "register index outside of the register bank");
+    static_assert(!CLEAR_ON_READ || READ_ONLY, "only read only registers are cleared by a read");
+
+public:
+    static constexpr int     index()       { return INDEX; }
+    static constexpr quint32 address()     { return static_cast<quint32>(INDEX * REGISTER_SIZE); }
+    static constexpr quint32 mask()        { return MASK; }
+    static constexpr bool    readOnly()    { return READ_ONLY; }
+    static constexpr bool    clearOnRead() { return CLEAR_ON_READ; }
+};
+
+// register map shared by all host components, mirrors the register_*_c
+// constants of audio_top.vhd, check() compares it against the firmware
+class RegisterMap
+{
+
+public:
+    //               index mask        read only  clear on read
+    typedef Register<0, 0xffffffff, true,  false> Version;
+    typedef Register<1, 0x000000ff, true,  true>  InMeterR;
+    typedef Register<2, 0x000000ff, true,  true>  InMeterL;
+    typedef Register<3, 0x000000ff, false, false> InFaderR;
+    typedef Register<4, 0x000000ff, false, false> InFaderL;
+    typedef Register<5, 0x000000ff, true,  true>  OutMeterR;
+    typedef Register<6, 0x000000ff, true,  true>  OutMeterL;
+    typedef Register<7, 0x000000ff, false, false> ConvFaderR;
+    typedef Register<8, 0x000000ff, false, false> ConvFaderL;
+    // first free register of the bank, used by the host only
+    typedef Register<9, 0xffffffff, false, false> FirBankSelect;
+
+    static const quint32 VERSION_INIT = 0xBEEF0123;  // register_init_c
+    static const quint32 FREE_MASK    = 0xffffffff;  // others of register_mask_c
+    static const int     ENTRY_COUNT  = 10;
+
+    struct Entry {
+        const char *name;       // register_address_<name>_c in audio_top.vhd
+        int         index;
+        quint32     mask;
+        bool        readOnly;
+        bool        clearOnRead;
+        bool        firmware;   // false for registers defined by the host only
+    };
+
+    static const Entry *getEntries();
+    static int          getEntryCount();
+    static const Entry *find(quint32 address);
+    static quint32      getMask(quint32 address);
+    static bool         isReadOnly(quint32 address);
+    static bool         isSideEffectFree(quint32 address);
+    static int          check(QString fileName, QStringList &differences);
+
+    template <typename R>
+    static int read(IRegisterAccess &access, quint32 &value)
+    {
+        QVector<quint32> data;
+        int error = access.read(R::address(), data, 1);
+        if ((error == AUDIO_SUCCESS) && !data.isEmpty()) {
+            value = data[0] & R::mask();
+        }
+        return error;
+    }
+
+    template <typename R>
+    static int write(IRegisterAccess &access, quint32 value)
+    {
+        static_assert(!R::readOnly(), "register is read only");
+        // bits outside of the mask are dropped by the firmware
+        if ((value & ~R::mask()) != 0) {
+            return AUDIO_DATA_FORMAT_ERROR;
+        }
+        QVector<quint32> data(1, value);
+        return access.write(R::address(), data);
+    }
+
+private:
+    template <typename R>
+    static constexpr Entry makeEntry(const char *name, bool firmware)
+    {
+        return {name, R::index(), R::mask(), R::readOnly(), R::clearOnRead(), firmware};
+    }
+
+    static constexpr bool contains(int)
+    {
+        return false;
+    }
+
+    template <typename... Rest>
+    static constexpr bool contains(int value, int first, Rest... rest)
+    {
+        return (value == first) || contains(value, rest...);
+    }
+
+    static constexpr bool distinct()
+    {
+        return true;
+    }
+
+    template <typename... Rest>
+    static constexpr bool distinct(int first, Rest... rest)
+    {
+        return !contains(first, rest...) && distinct(rest...);
+    }
+
+    friend struct RegisterMapCheck;
+};
+
+inline const RegisterMap::Entry *RegisterMap::getEntries()
+{
+    // one line per typedef above, the order is the register index
+    static const Entry entries[] = {
+        makeEntry<Version>("version", true),
+        makeEntry<InMeterR>("in_meter_r", true),
+        makeEntry<InMeterL>("in_meter_l", true),
+        makeEntry<InFaderR>("in_fader_r", true),
+        makeEntry<InFaderL>("in_fader_l", true),
+        makeEntry<OutMeterR>("out_meter_r", true),
+        makeEntry<OutMeterL>("out_meter_l", true),
+        makeEntry<ConvFaderR>("conv_fader_r", true),
+        makeEntry<ConvFaderL>("conv_fader_l", true),
+        makeEntry<FirBankSelect>("fir_bank_select", false)
+    };
+    static_assert(sizeof(entries) / sizeof(entries[0]) == ENTRY_COUNT, "one entry per register typedef");
+    return entries;
+}
+
+inline int RegisterMap::getEntryCount()
+{
+    return ENTRY_COUNT;
+}
+
+inline const RegisterMap::Entry *RegisterMap::find(quint32 address)
+{
+    // nullptr for free registers and addresses outside of the bank
+    if ((address % REGISTER_SIZE) != 0) {
+        return nullptr;
+    }
+    const Entry *entries = getEntries();
+    for (int entry=0; entry<getEntryCount(); entry++) {
+        if (static_cast<quint32>(entries[entry].index * REGISTER_SIZE) == address) {
+            return &entries[entry];
+        }
+    }
+    return nullptr;
+}
+
+inline quint32 RegisterMap::getMask(quint32 address)
+{
+    const Entry *entry = find(address);
+    return (entry != nullptr) ? entry->mask : FREE_MASK;
+}
+
+inline bool RegisterMap::isReadOnly(quint32 address)
+{
+    const Entry *entry = find(address);
+    return (entry != nullptr) && entry->readOnly;
+}
+
+inline bool RegisterMap::isSideEffectFree(quint32 address)
+{
+    // reading a meter resets its peak, the coefficient memories are not
+    // known here and are not read as gap
+    if (address >= static_cast<quint32>(REGISTER_COUNT * REGISTER_SIZE)) {
+        return false;
+    }
+    const Entry *entry = find(address);
+    return (entry == nullptr) || !entry->clearOnRead;
+}
+
+// compile time checks of the map
+struct RegisterMapCheck
+{
+    static_assert(RegisterMap::distinct(RegisterMap::Version::index(), RegisterMap::InMeterR::index(),
+                                        RegisterMap::InMeterL::index(), RegisterMap::InFaderR::index(),
+                                        RegisterMap::InFaderL::index(), RegisterMap::OutMeterR::index(),
+                                        RegisterMap::OutMeterL::index(), RegisterMap::ConvFaderR::index(),
+                                        RegisterMap::ConvFaderL::index(), RegisterMap::FirBankSelect::index()),
+                  "register indices must be unique");
+};
+
+#endif // REGISTERMAP_H
@@ -0,0 +1,81 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 20.01.2019
+// Filename  : registermock.cpp
+// Changelog : 20.01.2019 - file created
+//             17.10.2026 - asynchronous access added
+//             17.10.2026 - registers of the register map
+//------------------------------------------------------------------------------
+
+#include <QRandomGenerator>
+#include "registermock.h"
+#include "typedefinitions.h"
+#include "registermap.h"
+
+RegisterMock::RegisterMock()
+{
+    for (int index=0; index<REGISTER_COUNT; index++) {
+        _registers[index] = 0;
+    }
+    _registers[RegisterMap::Version::index()] = RegisterMap::VERSION_INIT;
+    _registers[RegisterMap::InMeterR::index()] = 50;
+}
+
+RegisterMock::~RegisterMock() {}
+
+int RegisterMock::read(quint32 address, QVector<quint32> &data, int length)
+{
+    for (int word=0; word<length; word++) {
+        quint32 wordAddress = address + static_cast<quint32>(word*REGISTER_SIZE);
+        int index = static_cast<int>(wordAddress / REGISTER_SIZE);
+        if (index >= REGISTER_COUNT) {
+            data.append(0x00);
+            continue;
+        }
+        // meters walk randomly around their last value
+        const RegisterMap::Entry *entry = RegisterMap::find(wordAddress);
+        if ((entry != nullptr) && entry->clearOnRead) {
+            quint32 value = _registers[index];
+            quint32 minValue = (value >= 10) ? value-10 : 0;
+            quint32 maxValue = (value <= 245) ? value+10 : 255;
+            _registers[index] = QRandomGenerator::global()->bounded(minValue, maxValue);
+        }
+        data.append(_registers[index] & RegisterMap::getMask(wordAddress));
+    }
+
+    return AUDIO_SUCCESS;
+}
+
+int RegisterMock::write(quint32 address, QVector<quint32> &data)
+{
+    for (int word=0; word<data.length(); word++) {
+        quint32 wordAddress = address + static_cast<quint32>(word*REGISTER_SIZE);
+        int index = static_cast<int>(wordAddress / REGISTER_SIZE);
+        if ((index < REGISTER_COUNT) && !RegisterMap::isReadOnly(wordAddress)) {
+            _registers[index] = data[word] & RegisterMap::getMask(wordAddress);
+        }
+    }
+    return AUDIO_SUCCESS;
+}
+
+int RegisterMock::readAsync(quint32 address, int length, ReadCallback callback)
+{
+    QVector<quint32> data;
+    int errorCode = read(address, data, length);
+    if (callback) {
+        callback(errorCode, data.constData(), data.length());
+    }
+    return AUDIO_SUCCESS;
+}
+
+int RegisterMock::writeAsync(quint32 address, const QVector<quint32> &data, WriteCallback callback)
+{
+    QVector<quint32> writeData(data);
+    int errorCode = write(address, writeData);
+    if (callback) {
+        callback(errorCode);
+    }
+    return AUDIO_SUCCESS;
+}
+
+void RegisterMock::poll(int) {}
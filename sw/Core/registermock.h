@@ -3,12 +3,15 @@
 // Date      : 20.01.2019
 // Filename  : registermock.h
 // Changelog : 20.01.2019 - file created
+//             17.10.2026 - asynchronous access added
+//             17.10.2026 - registers of the register map
 //------------------------------------------------------------------------------
 
 #ifndef REGISTERMOCK_H
 #define REGISTERMOCK_H
 
 #include "iregisteraccess.h"
+#include "typedefinitions.h"
 
 class RegisterMock : public IRegisterAccess
 {
@@ -18,12 +21,12 @@ public:
     ~RegisterMock() override;
     int read(quint32 address, QVector<quint32> &data, int length) override;
     int write(quint32 address, QVector<quint32> &data) override;
+    int  readAsync(quint32 address, int length, ReadCallback callback) override;
+    int  writeAsync(quint32 address, const QVector<quint32> &data, WriteCallback callback) override;
+    void poll(int waitMs) override;
 
 private:
-    quint32 _meterDataL;
-    quint32 _meterDataR;
-    quint32 _levelDataL;
-    quint32 _levelDataR;
+    quint32 _registers[REGISTER_COUNT];
 
 };
 
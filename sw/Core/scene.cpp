@@ -0,0 +1,171 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : scene.cpp
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#include <QFile>
+#include <QTextStream>
+#include <QStringList>
+#include "scene.h"
+#include "registermap.h"
+#include "typedefinitions.h"
+
+void Scene::clear()
+{
+    _values.clear();
+}
+
+bool Scene::isEmpty() const
+{
+    return _values.isEmpty();
+}
+
+int Scene::getCount() const
+{
+    return _values.size();
+}
+
+void Scene::setValue(quint32 address, quint32 value)
+{
+    _values.insert(address, value);
+}
+
+void Scene::setValues(quint32 address, const QVector<quint32> &data)
+{
+    // a block such as a coefficient bank
+    for (int word=0; word<data.length(); word++) {
+        _values.insert(address + static_cast<quint32>(word*REGISTER_SIZE), data[word]);
+    }
+}
+
+bool Scene::getValue(quint32 address, quint32 &value) const
+{
+    QMap<quint32, quint32>::const_iterator entry = _values.constFind(address);
+    if (entry == _values.constEnd()) {
+        return false;
+    }
+    value = entry.value();
+    return true;
+}
+
+bool Scene::contains(quint32 address) const
+{
+    return _values.contains(address);
+}
+
+QList<quint32> Scene::getAddresses() const
+{
+    return _values.keys();
+}
+
+void Scene::merge(const Scene &scene)
+{
+    // values of the other scene win
+    QMap<quint32, quint32>::const_iterator entry = scene._values.constBegin();
+    while (entry != scene._values.constEnd()) {
+        _values.insert(entry.key(), entry.value());
+        ++entry;
+    }
+}
+
+QVector<Scene::Run> Scene::diff(const Scene &shadow, int maxLength) const
+{
+    // runs of consecutive registers that differ from the shadow, registers in
+    // between with the same value are written again if that saves a packet
+    QVector<Run> runs;
+    bool open = false;
+    int  lastChanged = 0;
+    QMap<quint32, quint32>::const_iterator entry = _values.constBegin();
+    for (; entry != _values.constEnd(); ++entry) {
+        quint32 shadowValue = 0;
+        bool known = shadow.getValue(entry.key(), shadowValue);
+        bool changed = !known || (shadowValue != entry.value());
+        if (open) {
+            Run &run = runs.last();
+            quint32 next = run.address + static_cast<quint32>(run.data.length()*REGISTER_SIZE);
+            if ((entry.key() == next) && (run.data.length() < maxLength)) {
+                run.data.append(entry.value());
+                if (changed) {
+                    lastChanged = run.data.length() - 1;
+                }
+                continue;
+            }
+            // unchanged registers at the end are not sent
+            run.data.resize(lastChanged + 1);
+            open = false;
+        }
+        if (changed) {
+            Run run;
+            run.address = entry.key();
+            run.data.append(entry.value());
+            runs.append(run);
+            lastChanged = 0;
+            open = true;
+        }
+    }
+    if (open) {
+        runs.last().data.resize(lastChanged + 1);
+    }
+    return runs;
+}
+
+int Scene::save(QString fileName) const
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        return AUDIO_FILE_ERROR;
+    }
+    QTextStream out(&file);
+    out << "# address value" << endl;
+    QMap<quint32, quint32>::const_iterator entry = _values.constBegin();
+    for (; entry != _values.constEnd(); ++entry) {
+        out << "0x" << QString::number(entry.key(), 16).rightJustified(8, '0')
+            << " 0x" << QString::number(entry.value(), 16).rightJustified(8, '0') << '\n';
+    }
+    out.flush();
+    return (out.status() == QTextStream::Ok) ? AUDIO_SUCCESS : AUDIO_FILE_ERROR;
+}
+
+int Scene::load(QString fileName)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return AUDIO_FILE_ERROR;
+    }
+    // the scene is only replaced by a file that reads without error
+    QMap<quint32, quint32> values;
+    QTextStream in(&file);
+    while (!in.atEnd()) {
+        QString line = in.readLine().section('#', 0, 0).simplified();
+        if (line.isEmpty()) {
+            continue;
+        }
+        QStringList fields = line.split(' ');
+        bool addressValid = false;
+        bool valueValid = false;
+        quint32 address = fields[0].toUInt(&addressValid, 0);
+        quint32 value = (fields.length() == 2) ? fields[1].toUInt(&valueValid, 0) : 0;
+        if (!addressValid || !valueValid || ((address % REGISTER_SIZE) != 0)) {
+            return AUDIO_FILE_FORMAT_ERROR;
+        }
+        values.insert(address, value);
+    }
+    _values = values;
+    return AUDIO_SUCCESS;
+}
+
+QVector<quint32> Scene::getWritableRegisters()
+{
+    // the registers of the firmware a scene holds, host registers such as
+    // the bank select belong to their loader
+    QVector<quint32> addresses;
+    const RegisterMap::Entry *entries = RegisterMap::getEntries();
+    for (int index=0; index<RegisterMap::getEntryCount(); index++) {
+        if (entries[index].firmware && !entries[index].readOnly) {
+            addresses.append(static_cast<quint32>(entries[index].index * REGISTER_SIZE));
+        }
+    }
+    return addresses;
+}
@@ -0,0 +1,49 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : scene.h
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#ifndef SCENE_H
+#define SCENE_H
+
+#include <QMap>
+#include <QVector>
+#include <QString>
+
+// snapshot of the writable registers of a board, e.g. faders and later
+// coefficient banks, recalled as minimal diff against the board state
+//
+// scene file, one register per line, # starts a comment:
+//   <address> <value>
+class Scene
+{
+
+public:
+    struct Run {
+        quint32          address;
+        QVector<quint32> data;
+    };
+
+    void         clear();
+    bool         isEmpty() const;
+    int          getCount() const;
+    void         setValue(quint32 address, quint32 value);
+    void         setValues(quint32 address, const QVector<quint32> &data);
+    bool         getValue(quint32 address, quint32 &value) const;
+    bool         contains(quint32 address) const;
+    QList<quint32> getAddresses() const;
+    void         merge(const Scene &scene);
+    QVector<Run> diff(const Scene &shadow, int maxLength) const;
+    int          save(QString fileName) const;
+    int          load(QString fileName);
+
+    static QVector<quint32> getWritableRegisters();
+
+private:
+    QMap<quint32, quint32> _values;  // sorted by address
+
+};
+
+#endif // SCENE_H
@@ -0,0 +1,72 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : spscqueue.h
+// Changelog : 17.10.2026 - file created
+//             18.10.2026 - padding instead of over-aligned members
+//------------------------------------------------------------------------------
+
+#ifndef SPSCQUEUE_H
+#define SPSCQUEUE_H
+
+#include <atomic>
+#include <utility>
+
+// lock-free queue for exactly one producer thread and one consumer thread
+template <typename T, unsigned int SIZE>
+class SpscQueue
+{
+    static_assert((SIZE & (SIZE-1)) == 0, "queue size must be a power of two");
+
+public:
+    SpscQueue() :
+        _head(0),
+        _tail(0)
+    {
+
+    }
+
+    // producer side
+    bool push(const T &item)
+    {
+        unsigned int head = _head.load(std::memory_order_relaxed);
+        if ((head - _tail.load(std::memory_order_acquire)) >= SIZE) {
+            return false;
+        }
+        _buffer[head & MASK] = item;
+        _head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // consumer side
+    bool pop(T &item)
+    {
+        unsigned int tail = _tail.load(std::memory_order_relaxed);
+        if (tail == _head.load(std::memory_order_acquire)) {
+            return false;
+        }
+        item = std::move(_buffer[tail & MASK]);
+        _tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool isEmpty() const
+    {
+        return _tail.load(std::memory_order_acquire) == _head.load(std::memory_order_acquire);
+    }
+
+private:
+    static const unsigned int MASK = SIZE - 1;
+
+    static const unsigned int LINE_SIZE = 64;
+
+    // head and tail on separate cache lines, they are written by different
+    // threads. padded as new ignores alignas(64) before c++17
+    std::atomic<unsigned int> _head;
+    char _headPadding[LINE_SIZE - sizeof(std::atomic<unsigned int>)];
+    std::atomic<unsigned int> _tail;
+    char _tailPadding[LINE_SIZE - sizeof(std::atomic<unsigned int>)];
+    T _buffer[SIZE];
+};
+
+#endif // SPSCQUEUE_H
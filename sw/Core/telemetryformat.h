@@ -0,0 +1,95 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : telemetryformat.h
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#ifndef TELEMETRYFORMAT_H
+#define TELEMETRYFORMAT_H
+
+#include <QtGlobal>
+
+// capture file of the TelemetryRecorder, little endian
+//
+// the file is a sequence of fixed size blocks, block 0 holds the file header,
+// the data blocks follow in time order. every data block starts with a block
+// header carrying its time range and the boards it contains, the block
+// headers are the time index: a query does a binary search over them and
+// only touches the blocks of the requested range
+//
+// records are only appended, the count of a block is increased after its
+// records are written, so a reader never sees a partial record
+
+class TelemetryFormat
+{
+
+public:
+    static const quint64 MAGIC             = 0x4D4C544F49445541ULL;   // "AUDIOTLM"
+    static const quint32 VERSION           = 1;
+    static const int     BLOCK_SIZE        = 65536;   // multiple of the page size, blocks can be mapped on their own
+    static const int     BLOCK_HEADER_SIZE = 64;
+    static const int     RECORD_SIZE       = 16;
+    static const int     BLOCK_RECORDS     = (BLOCK_SIZE - BLOCK_HEADER_SIZE) / RECORD_SIZE;
+    static const int     BOARD_MASK_WORDS  = 4;       // one bit per board, LINK_MAX_BOARDS
+    static const qint64  MAX_TIME_OFFSET   = 0xFFFFFFFFLL;
+
+    enum Kind {
+        KIND_READ  = 0,   // value read from the board, e.g. meter level
+        KIND_WRITE = 1    // value written to the board, e.g. fader position
+    };
+
+    // a decoded record, as queued by the recorder and returned by queries
+    struct Sample {
+        qint64  time;         // us since epoch
+        quint32 address;
+        quint32 value;
+        quint16 board;
+        quint16 kind;
+    };
+
+    struct FileHeader {
+        quint64 magic;
+        quint32 version;
+        quint32 blockSize;
+        quint32 recordSize;
+        quint32 reserved;
+        qint64  startTime;    // us since epoch
+        quint64 blockCount;   // data blocks in use, the last one may be partly filled
+        quint8  padding[24];
+    };
+
+    struct BlockHeader {
+        qint64  firstTime;    // us since epoch
+        qint64  lastTime;
+        quint32 count;
+        quint32 reserved;
+        quint64 boardMask[BOARD_MASK_WORDS];
+        quint64 padding;
+    };
+
+    struct Record {
+        quint32 timeOffset;   // us after firstTime of the block
+        quint16 board;
+        quint16 kind;
+        quint32 address;
+        quint32 value;
+    };
+
+    static_assert(sizeof(FileHeader) == BLOCK_HEADER_SIZE, "file header size");
+    static_assert(sizeof(BlockHeader) == BLOCK_HEADER_SIZE, "block header size");
+    static_assert(sizeof(Record) == RECORD_SIZE, "record size");
+
+    static inline bool hasBoard(const BlockHeader &header, int board)
+    {
+        return (header.boardMask[(board >> 6) % BOARD_MASK_WORDS] >> (board & 63)) & 1;
+    }
+
+    static inline void addBoard(BlockHeader &header, int board)
+    {
+        header.boardMask[(board >> 6) % BOARD_MASK_WORDS] |= (1ULL << (board & 63));
+    }
+
+};
+
+#endif // TELEMETRYFORMAT_H
@@ -0,0 +1,159 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : telemetryreader.cpp
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#include "telemetryreader.h"
+#include "typedefinitions.h"
+
+TelemetryReader::TelemetryReader() :
+    _data(nullptr),
+    _blockCount(0),
+    _startTime(0)
+{
+
+}
+
+TelemetryReader::~TelemetryReader()
+{
+    close();
+}
+
+int TelemetryReader::open(QString fileName)
+{
+    close();
+
+    _file.setFileName(fileName);
+    if (!_file.open(QIODevice::ReadOnly)) {
+        return AUDIO_FILE_ERROR;
+    }
+    qint64 size = _file.size();
+    if (size < TelemetryFormat::BLOCK_SIZE) {
+        _file.close();
+        return AUDIO_FILE_FORMAT_ERROR;
+    }
+    _data = _file.map(0, size);
+    if (_data == nullptr) {
+        _file.close();
+        return AUDIO_FILE_ERROR;
+    }
+
+    const TelemetryFormat::FileHeader *header = reinterpret_cast<const TelemetryFormat::FileHeader *>(_data);
+    if ((header->magic != TelemetryFormat::MAGIC) || (header->version != TelemetryFormat::VERSION) ||
+        (header->blockSize != static_cast<quint32>(TelemetryFormat::BLOCK_SIZE)) ||
+        (header->recordSize != static_cast<quint32>(TelemetryFormat::RECORD_SIZE))) {
+        close();
+        return AUDIO_FILE_FORMAT_ERROR;
+    }
+
+    // a capture that is still written or was not closed can be shorter than the header says
+    quint64 fileBlocks = static_cast<quint64>(size / TelemetryFormat::BLOCK_SIZE) - 1;
+    _blockCount = qMin(header->blockCount, fileBlocks);
+    _startTime = header->startTime;
+    return AUDIO_SUCCESS;
+}
+
+void TelemetryReader::close()
+{
+    if (_data != nullptr) {
+        _file.unmap(_data);
+        _data = nullptr;
+    }
+    _file.close();
+    _blockCount = 0;
+    _startTime = 0;
+}
+
+qint64 TelemetryReader::getStartTime()
+{
+    return _startTime;
+}
+
+qint64 TelemetryReader::getEndTime()
+{
+    if (_blockCount == 0) {
+        return _startTime;
+    }
+    return getBlock(_blockCount-1)->lastTime;
+}
+
+quint64 TelemetryReader::getBlockCount()
+{
+    return _blockCount;
+}
+
+int TelemetryReader::query(int board, qint64 from, qint64 to, QVector<TelemetryFormat::Sample> &samples)
+{
+    if (_data == nullptr) {
+        return AUDIO_FILE_ERROR;
+    }
+
+    for (quint64 index=findBlock(from); index<_blockCount; index++) {
+        const TelemetryFormat::BlockHeader *block = getBlock(index);
+        if (block->firstTime > to) {
+            break;
+        }
+        // blocks without the board are skipped without touching their records
+        if ((board >= 0) && !TelemetryFormat::hasBoard(*block, board)) {
+            continue;
+        }
+
+        const TelemetryFormat::Record *records = reinterpret_cast<const TelemetryFormat::Record *>(
+                    reinterpret_cast<const uchar *>(block) + TelemetryFormat::BLOCK_HEADER_SIZE);
+        int count = qMin(static_cast<int>(block->count), static_cast<int>(TelemetryFormat::BLOCK_RECORDS));
+
+        // the records of a block are in time order as well
+        int first = 0;
+        int last = count;
+        while (first < last) {
+            int middle = (first + last) / 2;
+            if ((block->firstTime + records[middle].timeOffset) < from) {
+                first = middle + 1;
+            } else {
+                last = middle;
+            }
+        }
+
+        for (int record=first; record<count; record++) {
+            qint64 time = block->firstTime + records[record].timeOffset;
+            if (time > to) {
+                break;
+            }
+            if ((board >= 0) && (records[record].board != board)) {
+                continue;
+            }
+            TelemetryFormat::Sample sample;
+            sample.time = time;
+            sample.address = records[record].address;
+            sample.value = records[record].value;
+            sample.board = records[record].board;
+            sample.kind = records[record].kind;
+            samples.append(sample);
+        }
+    }
+    return AUDIO_SUCCESS;
+}
+
+const TelemetryFormat::BlockHeader *TelemetryReader::getBlock(quint64 index)
+{
+    // block 0 is the file header
+    return reinterpret_cast<const TelemetryFormat::BlockHeader *>(_data + (index + 1) * TelemetryFormat::BLOCK_SIZE);
+}
+
+quint64 TelemetryReader::findBlock(qint64 time)
+{
+    // first block that ends at or after the time
+    quint64 first = 0;
+    quint64 last = _blockCount;
+    while (first < last) {
+        quint64 middle = (first + last) / 2;
+        if (getBlock(middle)->lastTime < time) {
+            first = middle + 1;
+        } else {
+            last = middle;
+        }
+    }
+    return first;
+}
@@ -0,0 +1,47 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : telemetryreader.h
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#ifndef TELEMETRYREADER_H
+#define TELEMETRYREADER_H
+
+#include <QFile>
+#include <QVector>
+
+#include "telemetryformat.h"
+
+// queries a capture file of the TelemetryRecorder
+//
+// the file is mapped, a query only touches the block headers of its binary
+// search and the blocks within the time range, so the cost does not depend
+// on the size of the capture
+class TelemetryReader
+{
+
+public:
+    TelemetryReader();
+    ~TelemetryReader();
+
+    int     open(QString fileName);
+    void    close();
+    qint64  getStartTime();
+    qint64  getEndTime();
+    quint64 getBlockCount();
+
+    // samples of a board (all boards if negative) with from <= time <= to, in us since epoch
+    int     query(int board, qint64 from, qint64 to, QVector<TelemetryFormat::Sample> &samples);
+
+private:
+    const TelemetryFormat::BlockHeader *getBlock(quint64 index);
+    quint64                             findBlock(qint64 time);
+
+    QFile   _file;
+    uchar   *_data;
+    quint64 _blockCount;
+    qint64  _startTime;
+};
+
+#endif // TELEMETRYREADER_H
@@ -0,0 +1,104 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : telemetryrecorder.cpp
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#include "telemetryrecorder.h"
+#include "typedefinitions.h"
+
+#include <QDateTime>
+
+TelemetryRecorder::TelemetryRecorder(QObject *parent) :
+    QObject(parent),
+    _thread(this),
+    // the queue is too large for the stack
+    _queue(new TelemetryQueue()),
+    _worker(new TelemetryWriter(*_queue)),
+    _startTime(0),
+    _recording(false),
+    _recordedSamples(0),
+    _droppedSamples(0)
+{
+    _worker->moveToThread(&_thread);
+    connect(&_thread, SIGNAL(started()), _worker, SLOT(start()));
+    connect(&_thread, SIGNAL(finished()), _worker, SLOT(deleteLater()));
+    _thread.setObjectName("TelemetryRecorder");
+    _thread.start(QThread::LowPriority);
+}
+
+TelemetryRecorder::~TelemetryRecorder()
+{
+    stop();
+    _thread.quit();
+    _thread.wait();
+    delete _queue;
+}
+
+int TelemetryRecorder::start(QString fileName)
+{
+    stop();
+
+    // absolute time for the file, the elapsed timer keeps it monotonic
+    _clock.start();
+    _startTime = QDateTime::currentMSecsSinceEpoch() * 1000;
+    _recordedSamples = 0;
+    _droppedSamples = 0;
+
+    int error = AUDIO_FILE_ERROR;
+    QMetaObject::invokeMethod(_worker, "open", Qt::BlockingQueuedConnection,
+                              Q_RETURN_ARG(int, error), Q_ARG(QString, fileName), Q_ARG(qint64, _startTime));
+    _recording = (error == AUDIO_SUCCESS);
+    return error;
+}
+
+int TelemetryRecorder::stop()
+{
+    if (!_recording) {
+        return AUDIO_SUCCESS;
+    }
+    _recording = false;
+
+    // the writer drains the rest of the queue before the file is closed
+    int error = AUDIO_FILE_ERROR;
+    QMetaObject::invokeMethod(_worker, "close", Qt::BlockingQueuedConnection,
+                              Q_RETURN_ARG(int, error));
+    return error;
+}
+
+bool TelemetryRecorder::isRecording()
+{
+    return _recording;
+}
+
+void TelemetryRecorder::record(int board, quint32 address, quint32 value, TelemetryFormat::Kind kind)
+{
+    if (!_recording) {
+        return;
+    }
+
+    TelemetryFormat::Sample sample;
+    sample.time = _startTime + _clock.nsecsElapsed() / 1000;
+    sample.address = address;
+    sample.value = value;
+    sample.board = static_cast<quint16>(board);
+    sample.kind = static_cast<quint16>(kind);
+
+    // the polling path never waits for the disk, a full queue drops the sample
+    if (_queue->push(sample)) {
+        _recordedSamples++;
+    } else {
+        _droppedSamples++;
+    }
+}
+
+quint32 TelemetryRecorder::getRecordedSamples()
+{
+    return _recordedSamples;
+}
+
+quint32 TelemetryRecorder::getDroppedSamples()
+{
+    return _droppedSamples;
+}
@@ -0,0 +1,49 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : telemetryrecorder.h
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#ifndef TELEMETRYRECORDER_H
+#define TELEMETRYRECORDER_H
+
+#include <QObject>
+#include <QThread>
+#include <QElapsedTimer>
+
+#include "telemetrywriter.h"
+
+// records register values of all boards with a timestamp
+//
+// record() is called by the Updaters in the GUI thread, it only pushes the
+// sample to a lock-free queue. a writer thread drains the queue into the
+// capture file, see TelemetryFormat and TelemetryReader
+class TelemetryRecorder : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit TelemetryRecorder(QObject *parent = nullptr);
+    ~TelemetryRecorder() override;
+
+    int     start(QString fileName);
+    int     stop();
+    bool    isRecording();
+    void    record(int board, quint32 address, quint32 value, TelemetryFormat::Kind kind);
+    quint32 getRecordedSamples();
+    quint32 getDroppedSamples();
+
+private:
+    QThread         _thread;
+    TelemetryQueue  *_queue;
+    TelemetryWriter *_worker;
+    QElapsedTimer   _clock;
+    qint64          _startTime;
+    bool            _recording;
+    quint32         _recordedSamples;
+    quint32         _droppedSamples;
+
+};
+
+#endif // TELEMETRYRECORDER_H
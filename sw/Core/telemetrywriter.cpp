@@ -0,0 +1,176 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : telemetrywriter.cpp
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#include "telemetrywriter.h"
+#include "typedefinitions.h"
+
+#include <cstring>
+#include <atomic>
+
+TelemetryWriter::TelemetryWriter(TelemetryQueue &queue) :
+    QObject(nullptr),
+    _queue(queue),
+    _drainTimer(nullptr),
+    _file(nullptr),
+    _fileHeader(nullptr),
+    _segment(nullptr),
+    _segmentIndex(0),
+    _block(nullptr),
+    _records(nullptr),
+    _blockCount(0),
+    _error(AUDIO_SUCCESS)
+{
+
+}
+
+void TelemetryWriter::start()
+{
+    // created inside the writer thread so the timer runs in its event loop
+    _file = new QFile(this);
+    _drainTimer = new QTimer(this);
+    _drainTimer->setInterval(DRAIN_INTERVAL);
+    connect(_drainTimer, SIGNAL(timeout()), this, SLOT(drain()));
+}
+
+int TelemetryWriter::open(QString fileName, qint64 startTime)
+{
+    close();
+
+    _file->setFileName(fileName);
+    if (!_file->open(QIODevice::ReadWrite | QIODevice::Truncate) || !_file->resize(TelemetryFormat::BLOCK_SIZE)) {
+        _file->close();
+        return AUDIO_FILE_ERROR;
+    }
+    _fileHeader = reinterpret_cast<TelemetryFormat::FileHeader *>(_file->map(0, TelemetryFormat::BLOCK_SIZE));
+    if (_fileHeader == nullptr) {
+        _file->close();
+        return AUDIO_FILE_ERROR;
+    }
+
+    std::memset(_fileHeader, 0, sizeof(TelemetryFormat::FileHeader));
+    _fileHeader->magic = TelemetryFormat::MAGIC;
+    _fileHeader->version = TelemetryFormat::VERSION;
+    _fileHeader->blockSize = TelemetryFormat::BLOCK_SIZE;
+    _fileHeader->recordSize = TelemetryFormat::RECORD_SIZE;
+    _fileHeader->startTime = startTime;
+    _fileHeader->blockCount = 0;
+
+    _blockCount = 0;
+    _block = nullptr;
+    _records = nullptr;
+    _error = AUDIO_SUCCESS;
+    _drainTimer->start();
+    return AUDIO_SUCCESS;
+}
+
+int TelemetryWriter::close()
+{
+    if (_fileHeader == nullptr) {
+        return AUDIO_SUCCESS;
+    }
+
+    // whatever is still queued belongs to this file
+    drain();
+    _drainTimer->stop();
+
+    unmapSegment();
+    _file->unmap(reinterpret_cast<uchar *>(_fileHeader));
+    _fileHeader = nullptr;
+    _block = nullptr;
+    _records = nullptr;
+
+    // drop the preallocated blocks of the last segment
+    _file->resize(static_cast<qint64>(_blockCount + 1) * TelemetryFormat::BLOCK_SIZE);
+    _file->close();
+    return _error;
+}
+
+void TelemetryWriter::drain()
+{
+    TelemetryFormat::Sample sample;
+    while (_queue.pop(sample)) {
+        if (_fileHeader != nullptr) {
+            append(sample);
+        }
+    }
+}
+
+void TelemetryWriter::append(const TelemetryFormat::Sample &sample)
+{
+    // the samples of one producer are in time order, keep it that way for
+    // the binary search even if the clock should jump back
+    qint64 time = sample.time;
+    if ((_block != nullptr) && (time < _block->lastTime)) {
+        time = _block->lastTime;
+    }
+
+    if ((_block == nullptr) || (_block->count >= static_cast<quint32>(TelemetryFormat::BLOCK_RECORDS)) ||
+        ((time - _block->firstTime) > TelemetryFormat::MAX_TIME_OFFSET)) {
+        if (!startBlock(time)) {
+            return;
+        }
+    }
+
+    TelemetryFormat::Record &record = _records[_block->count];
+    record.timeOffset = static_cast<quint32>(time - _block->firstTime);
+    record.board = sample.board;
+    record.kind = sample.kind;
+    record.address = sample.address;
+    record.value = sample.value;
+    TelemetryFormat::addBoard(*_block, sample.board);
+    _block->lastTime = time;
+
+    // a reader of the running capture must not see the count before the record
+    std::atomic_thread_fence(std::memory_order_release);
+    _block->count++;
+}
+
+bool TelemetryWriter::startBlock(qint64 time)
+{
+    quint64 segment = _blockCount / SEGMENT_BLOCKS;
+    if ((_segment == nullptr) || (segment != _segmentIndex)) {
+        if (!mapSegment(segment)) {
+            _block = nullptr;
+            _error = AUDIO_FILE_ERROR;
+            return false;
+        }
+    }
+
+    uchar *block = _segment + (_blockCount % SEGMENT_BLOCKS) * TelemetryFormat::BLOCK_SIZE;
+    _block = reinterpret_cast<TelemetryFormat::BlockHeader *>(block);
+    _records = reinterpret_cast<TelemetryFormat::Record *>(block + TelemetryFormat::BLOCK_HEADER_SIZE);
+    std::memset(_block, 0, sizeof(TelemetryFormat::BlockHeader));
+    _block->firstTime = time;
+    _block->lastTime = time;
+
+    _blockCount++;
+    _fileHeader->blockCount = _blockCount;
+    return true;
+}
+
+bool TelemetryWriter::mapSegment(quint64 segment)
+{
+    unmapSegment();
+
+    // block 0 is the file header, the data blocks follow
+    qint64 offset = static_cast<qint64>(1 + segment * SEGMENT_BLOCKS) * TelemetryFormat::BLOCK_SIZE;
+    qint64 size = static_cast<qint64>(SEGMENT_BLOCKS) * TelemetryFormat::BLOCK_SIZE;
+    if (!_file->resize(offset + size)) {
+        return false;
+    }
+    _segment = _file->map(offset, size);
+    _segmentIndex = segment;
+    return (_segment != nullptr);
+}
+
+void TelemetryWriter::unmapSegment()
+{
+    if (_segment != nullptr) {
+        _file->unmap(_segment);
+        _segment = nullptr;
+    }
+}
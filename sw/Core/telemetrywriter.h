@@ -0,0 +1,58 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : telemetrywriter.h
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#ifndef TELEMETRYWRITER_H
+#define TELEMETRYWRITER_H
+
+#include <QObject>
+#include <QTimer>
+#include <QFile>
+
+#include "spscqueue.h"
+#include "telemetryformat.h"
+
+static const unsigned int TELEMETRY_QUEUE_SIZE = 16384;
+
+typedef SpscQueue<TelemetryFormat::Sample, TELEMETRY_QUEUE_SIZE> TelemetryQueue;
+
+// lives in the thread of the TelemetryRecorder, drains the queue into the
+// memory mapped capture file
+class TelemetryWriter : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit TelemetryWriter(TelemetryQueue &queue);
+
+public slots:
+    void start();
+    int  open(QString fileName, qint64 startTime);
+    int  close();
+    void drain();
+
+private:
+    static const int SEGMENT_BLOCKS = 64;    // the file grows and is mapped in steps of 4 MB
+    static const int DRAIN_INTERVAL = 100;
+
+    void append(const TelemetryFormat::Sample &sample);
+    bool startBlock(qint64 time);
+    bool mapSegment(quint64 segment);
+    void unmapSegment();
+
+    TelemetryQueue               &_queue;
+    QTimer                       *_drainTimer;
+    QFile                        *_file;
+    TelemetryFormat::FileHeader  *_fileHeader;
+    uchar                        *_segment;
+    quint64                      _segmentIndex;
+    TelemetryFormat::BlockHeader *_block;
+    TelemetryFormat::Record      *_records;
+    quint64                      _blockCount;
+    int                          _error;
+};
+
+#endif // TELEMETRYWRITER_H
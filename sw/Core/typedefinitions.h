@@ -0,0 +1,70 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 27.12.2018
+// Filename  : typedefinitions.h
+// Changelog : 27.12.2018 - file created
+//             17.10.2026 - busy error added
+//             17.10.2026 - register bank constants added
+//             17.10.2026 - board error added
+//             17.10.2026 - transfer size limit added
+//             17.10.2026 - remote timeout error added
+//             17.10.2026 - verify and file errors added
+//             17.10.2026 - register count added
+//             17.10.2026 - error count added
+//             18.10.2026 - blocking error added
+//------------------------------------------------------------------------------
+
+#ifndef TYPEDEFINITIONS_H
+#define TYPEDEFINITIONS_H
+
+// error codes
+static const int AUDIO_SUCCESS               = 0;
+static const int AUDIO_LENGTH_ERROR          = 1;
+static const int AUDIO_TIMEOUT_ERROR         = 2;
+static const int AUDIO_TYPE_ERROR            = 3;
+static const int AUDIO_RECEIVED_LENGTH_ERROR = 4;
+static const int AUDIO_PACKET_LENGTH_ERROR   = 5;
+static const int AUDIO_DATA_FORMAT_ERROR     = 6;
+static const int AUDIO_ADDRESS_FORMAT_ERROR  = 7;
+static const int AUDIO_BUSY_ERROR            = 8;
+static const int AUDIO_BOARD_ERROR           = 9;
+static const int AUDIO_REMOTE_TIMEOUT_ERROR  = 10;
+static const int AUDIO_VERIFY_ERROR          = 11;
+static const int AUDIO_FILE_ERROR            = 12;
+static const int AUDIO_FILE_FORMAT_ERROR     = 13;
+static const int AUDIO_BLOCKING_ERROR        = 14;
+static const int AUDIO_ERROR_COUNT           = 15;  // number of error codes above
+
+// packet types
+static const char UDP_READ          = 0x01;
+static const char UDP_WRITE         = 0x02;
+static const char UDP_READ_RESPONSE = 0x04;
+static const char UDP_READ_TIMEOUT  = 0x08;
+
+// register bank
+static const int REGISTER_SIZE   = 4;   // byte address increment per register
+static const int REGISTER_COUNT  = 16;  // register_count_c of audio_top
+static const int MAX_BURST_WORDS = 32;  // burst_size_g of eth_ctrl / registerbank
+
+// largest read or write of a single request packet in words
+static const int MAX_TRANSFER_WORDS = 256;
+
+// error code translator
+#define errorToString(a) (a == AUDIO_SUCCESS)               ? "successful" : \
+                         (a == AUDIO_LENGTH_ERROR)          ? "error: too much data requested" : \
+                         (a == AUDIO_TIMEOUT_ERROR)         ? "error: timeout" : \
+                         (a == AUDIO_TYPE_ERROR)            ? "error: wrong packet type received" : \
+                         (a == AUDIO_RECEIVED_LENGTH_ERROR) ? "error: wrong length received" : \
+                         (a == AUDIO_PACKET_LENGTH_ERROR)   ? "error: received packet too short" : \
+                         (a == AUDIO_DATA_FORMAT_ERROR)     ? "error: data format wrong" : \
+                         (a == AUDIO_ADDRESS_FORMAT_ERROR)  ? "error: address format wrong" : \
+                         (a == AUDIO_BUSY_ERROR)            ? "error: too many requests pending" : \
+                         (a == AUDIO_BOARD_ERROR)           ? "error: unknown board" : \
+                         (a == AUDIO_REMOTE_TIMEOUT_ERROR)  ? "error: register bank timeout" : \
+                         (a == AUDIO_VERIFY_ERROR)          ? "error: read back differs" : \
+                         (a == AUDIO_FILE_ERROR)            ? "error: file can not be read" : \
+                         (a == AUDIO_FILE_FORMAT_ERROR)     ? "error: file format not supported" : \
+                         (a == AUDIO_BLOCKING_ERROR)        ? "error: blocking call not allowed" : \
+                                                              "error: unknown"
+
+#endif // TYPEDEFINITIONS_H
@@ -0,0 +1,68 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 27.12.2018
+// Filename  : udptransfer.cpp
+// Changelog : 27.12.2018 - file created
+//             17.10.2026 - wait for packet added
+//             17.10.2026 - id indexed receive table
+//             17.10.2026 - multiple peers on one socket
+//             17.10.2026 - packets passed without copies
+//             17.10.2026 - byte counters and receive backlog
+//             17.10.2026 - packets of unknown senders for the board scan
+//             17.10.2026 - peers and receive tables moved to DatagramTransfer
+//             18.10.2026 - send time error of scheduled datagrams
+//------------------------------------------------------------------------------
+
+#include "udptransfer.h"
+#include "packetcodec.h"
+
+UdpTransfer::UdpTransfer(QObject *parent) :
+    DatagramTransfer(parent),
+    _sendSocket(this),
+    _datagram(PacketCodec::MAX_PACKET_SIZE, 0)
+{
+    _sendSocket.bind(getHostAddress(), getPort());
+    connect(&_sendSocket, SIGNAL(readyRead()), this, SLOT(readyRead()));
+}
+
+void UdpTransfer::updateSocket()
+{
+    disconnect(&_sendSocket, SIGNAL(readyRead()), this, SLOT(readyRead()));
+    _sendSocket.abort();
+    _sendSocket.bind(getHostAddress(), getPort());
+    connect(&_sendSocket, SIGNAL(readyRead()), this, SLOT(readyRead()));
+}
+
+void UdpTransfer::sendDatagram(int peer, quint32 address, const char *data, int size, qint64 deadlineNs)
+{
+    Q_UNUSED(peer);
+    _sendSocket.writeDatagram(data, size, QHostAddress(address), getPort());
+    recordSendTime(deadlineNs);
+}
+
+void UdpTransfer::waitForPacket(int waitMs)
+{
+    _sendSocket.waitForReadyRead(waitMs);
+}
+
+void UdpTransfer::readyRead()
+{
+    // drain everything that arrived since the last notification
+    quint32 backlog = 0;
+    while (_sendSocket.hasPendingDatagrams()) {
+        backlog++;
+        if (_sendSocket.pendingDatagramSize() > PacketCodec::MAX_PACKET_SIZE) {
+            _sendSocket.readDatagram(nullptr, 0);
+            countDroppedPacket();
+            continue;
+        }
+        qint64 size = _sendSocket.readDatagram(_datagram.data(), _datagram.size(), &_sender);
+        if (size < 1) {
+            countDroppedPacket();
+            continue;
+        }
+        // QUdpSocket has no timestamps, RegisterAccess measures itself
+        receivePacket(_sender.toIPv4Address(), _datagram, static_cast<int>(size), 0);
+    }
+    updateReceiveBacklog(backlog);
+}
@@ -0,0 +1,47 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 27.12.2018
+// Filename  : udptransfer.h
+// Changelog : 27.12.2018 - file created
+//             17.10.2026 - wait for packet added
+//             17.10.2026 - id indexed receive table
+//             17.10.2026 - multiple peers on one socket
+//             17.10.2026 - packets passed without copies
+//             17.10.2026 - byte counters and receive backlog
+//             17.10.2026 - packets of unknown senders for the board scan
+//             17.10.2026 - peers and receive tables moved to DatagramTransfer
+//             18.10.2026 - send time error of scheduled datagrams
+//------------------------------------------------------------------------------
+
+#ifndef UDPTRANSFER_H
+#define UDPTRANSFER_H
+
+#include <QUdpSocket>
+#include "datagramtransfer.h"
+
+// transport on a QUdpSocket, the datagrams are received in the Qt event
+// loop of the thread that owns it
+class UdpTransfer : public DatagramTransfer
+{
+    Q_OBJECT
+
+public:
+    explicit UdpTransfer(QObject *parent = nullptr);
+
+    void waitForPacket(int waitMs) override;
+
+public slots:
+    void readyRead();
+
+protected:
+    void sendDatagram(int peer, quint32 address, const char *data, int size, qint64 deadlineNs) override;
+    void updateSocket() override;
+
+private:
+    QUdpSocket   _sendSocket;
+    QByteArray   _datagram;
+    QHostAddress _sender;
+
+};
+
+#endif // UDPTRANSFER_H
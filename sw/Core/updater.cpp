@@ -0,0 +1,440 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 20.01.2019
+// Filename  : updater.cpp
+// Changelog : 20.01.2019 - file created
+//             17.10.2026 - asynchronous update
+//             17.10.2026 - burst transfers
+//             17.10.2026 - write on change
+//             17.10.2026 - external update tick
+//             17.10.2026 - allocation free update
+//             17.10.2026 - telemetry recording
+//             17.10.2026 - gaps checked against the register map
+//             17.10.2026 - scene capture and recall
+//             17.10.2026 - suspended writes for the automation
+//             18.10.2026 - plan kept while writes are pending
+//             18.10.2026 - shadow takes the value sent
+//             18.10.2026 - written registers read back
+//             18.10.2026 - recall deferred while writes are suspended
+//------------------------------------------------------------------------------
+
+#include "updater.h"
+#include "typedefinitions.h"
+
+Updater::Updater(IRegisterAccess *registerAccess, QObject *parent) :
+    QObject(parent),
+    _timer(this),
+    _recallPending(0),
+    _writeCount(0),
+    _writesSuspended(false),
+    _planRequired(false),
+    _maxReadGap(4),
+    _writeIntervalMs(0),
+    _resyncIntervalMs(0),
+    _registerAccess(registerAccess),
+    _recorder(nullptr),
+    _board(0)
+{
+    connect(&_timer, SIGNAL(timeout()), this, SLOT(update()));
+    _timer.start(20);
+    _resyncTimer.start();
+}
+
+void Updater::addElement(uint address, IUpdateElement *element, bool read)
+{
+    Element entry;
+    entry.element = element;
+    entry.address = address;
+    entry.read = read;
+    entry.value = 0;
+    entry.sent = 0;
+    entry.sentWrite = 0;
+    entry.shadow = 0;
+    entry.shadowValid = false;
+    _elementVector.append(entry);
+    _planRequired = true;
+}
+
+void Updater::setInterval(int intervalMs)
+{
+    // 0 stops the own timer, update() is then called by the owner
+    if (intervalMs > 0) {
+        _timer.start(intervalMs);
+    } else {
+        _timer.stop();
+    }
+}
+
+void Updater::setMaxReadGap(int words)
+{
+    // gap registers with read side effects are never read, see RegisterMap
+    _maxReadGap = words;
+    _planRequired = true;
+}
+
+void Updater::setWriteInterval(int intervalMs)
+{
+    // faster changes are coalesced, only the latest value is sent
+    _writeIntervalMs = intervalMs;
+}
+
+void Updater::setResyncInterval(int intervalMs)
+{
+    // 0 disables the periodic rewrite of all write elements
+    _resyncIntervalMs = intervalMs;
+    _resyncTimer.restart();
+}
+
+void Updater::invalidateShadow()
+{
+    for (int index=0; index<_elementVector.length(); index++) {
+        _elementVector[index].shadowValid = false;
+    }
+    invalidateSceneShadow();
+}
+
+void Updater::setRecorder(TelemetryRecorder *recorder, int board)
+{
+    // nullptr stops recording of this updater
+    _recorder = recorder;
+    _board = board;
+}
+
+void Updater::captureScene(Scene &scene)
+{
+    // registers of write elements hold what the element shows now
+    scene.merge(_sceneShadow);
+    foreach (const Element &entry, _elementVector) {
+        if (!entry.read) {
+            unsigned int value = 0;
+            entry.element->updateParam(&value);
+            scene.setValue(entry.address, value);
+        }
+    }
+}
+
+void Updater::recallScene(const Scene &scene)
+{
+    // nothing is written while suspended, the last value of each register
+    // is recalled when the writes resume
+    if (_writesSuspended) {
+        _suspendedScene.merge(scene);
+        return;
+    }
+
+    // write elements take their value, the next write burst sends what
+    // differs from their shadow
+    Scene direct;
+    foreach (quint32 address, scene.getAddresses()) {
+        quint32 value = 0;
+        scene.getValue(address, value);
+        bool owned = false;
+        foreach (const Element &entry, _elementVector) {
+            if (!entry.read && (entry.address == address)) {
+                entry.element->recallParam(value);
+                owned = true;
+            }
+        }
+        if (!owned) {
+            direct.setValue(address, value);
+        }
+    }
+
+    // the other registers are written as runs of what differs from the last recall
+    foreach (const Scene::Run &run, direct.diff(_sceneShadow, MAX_TRANSFER_WORDS)) {
+        _recallPending++;
+        int error = _registerAccess->writeAsync(run.address, run.data, [this, run](int writeError) {
+            _recallPending--;
+            if (writeError == AUDIO_SUCCESS) {
+                _sceneShadow.setValues(run.address, run.data);
+            }
+        });
+        if (error != AUDIO_SUCCESS) {
+            _recallPending--;
+            continue;
+        }
+        for (int word=0; (word<run.data.length()) && (_recorder != nullptr); word++) {
+            _recorder->record(_board, run.address + static_cast<quint32>(word*REGISTER_SIZE), run.data[word],
+                              TelemetryFormat::KIND_WRITE);
+        }
+    }
+
+    // the element registers go out with the same round trip
+    if (_planRequired) {
+        plan();
+    }
+    for (int index=0; index<_writeTransfers.length(); index++) {
+        writeBurst(index);
+    }
+}
+
+bool Updater::isRecallPending()
+{
+    // writes of registers without element only
+    return _recallPending > 0;
+}
+
+void Updater::invalidateSceneShadow()
+{
+    // after writes past the Updater the next recall sends everything
+    _sceneShadow.clear();
+}
+
+void Updater::acknowledgeScene(const Scene &scene)
+{
+    // the board got these values past the Updater, they are not sent again
+    foreach (quint32 address, scene.getAddresses()) {
+        quint32 value = 0;
+        scene.getValue(address, value);
+        bool owned = false;
+        for (int index=0; index<_elementVector.length(); index++) {
+            Element &entry = _elementVector[index];
+            if (!entry.read && (entry.address == address)) {
+                entry.shadow = value;
+                entry.shadowValid = true;
+                owned = true;
+            }
+        }
+        if (!owned) {
+            _sceneShadow.setValue(address, value);
+        }
+    }
+}
+
+void Updater::setWritesSuspended(bool suspended)
+{
+    // reads go on, e.g. the meters during an automation playback
+    _writesSuspended = suspended;
+    if (!_writesSuspended && !_suspendedScene.isEmpty()) {
+        Scene scene = _suspendedScene;
+        _suspendedScene.clear();
+        recallScene(scene);
+    }
+}
+
+void Updater::update()
+{
+    // collect responses of the previous tick without blocking
+    _registerAccess->poll(0);
+
+    if (_planRequired) {
+        plan();
+    }
+
+    // rewrite everything now and then in case the board was restarted
+    if ((_resyncIntervalMs > 0) && _resyncTimer.hasExpired(_resyncIntervalMs)) {
+        invalidateShadow();
+        _resyncTimer.restart();
+    }
+
+    for (int index=0; index<_readTransfers.length(); index++) {
+        // do not stack up reads while the board is not answering
+        if (!_readTransfers[index].pending) {
+            readBurst(index);
+        }
+    }
+    for (int index=0; (index<_writeTransfers.length()) && !_writesSuspended; index++) {
+        writeBurst(index);
+    }
+}
+
+void Updater::plan()
+{
+    // responses of the old plan refer to their transfer index
+    foreach (const ReadTransfer &transfer, _readTransfers) {
+        if (transfer.pending) {
+            return;
+        }
+    }
+    foreach (const WriteTransfer &transfer, _writeTransfers) {
+        if (transfer.pending > 0) {
+            return;
+        }
+    }
+
+    // reads may span unregistered registers, writes must not touch them
+    BurstPlanner readPlanner(_maxReadGap, MAX_BURST_WORDS);
+    BurstPlanner writePlanner(0, MAX_BURST_WORDS);
+    readPlanner.setGapFilter(RegisterMap::isSideEffectFree);
+    for (int index=0; index<_elementVector.length(); index++) {
+        if (_elementVector[index].read) {
+            readPlanner.addRegister(_elementVector[index].address, index);
+        } else {
+            writePlanner.addRegister(_elementVector[index].address, index);
+        }
+    }
+
+    _readTransfers.clear();
+    foreach (const BurstPlanner::Burst &burst, readPlanner.plan()) {
+        ReadTransfer transfer;
+        transfer.burst = burst;
+        transfer.pending = false;
+        _readTransfers.append(transfer);
+    }
+    _writeTransfers.clear();
+    foreach (const BurstPlanner::Burst &burst, writePlanner.plan()) {
+        WriteTransfer transfer;
+        transfer.burst = burst;
+        transfer.pending = 0;
+        _writeTransfers.append(transfer);
+    }
+    _planRequired = false;
+}
+
+void Updater::readBurst(int index)
+{
+    ReadTransfer &transfer = _readTransfers[index];
+    transfer.pending = true;
+    int error = _registerAccess->readAsync(transfer.burst.address, transfer.burst.length, [this, index](int readError, const quint32 *data, int length) {
+        ReadTransfer &done = _readTransfers[index];
+        done.pending = false;
+        if ((readError == AUDIO_SUCCESS) && (length >= done.burst.length)) {
+            // fan the burst out to the elements
+            foreach (const BurstPlanner::Target &target, done.burst.targets) {
+                unsigned int readParam = data[target.offset];
+                IUpdateElement *element = _elementVector[target.element].element;
+                // an element without widget only keeps the link busy, e.g. for supervision
+                if (element != nullptr) {
+                    element->updateParam(&readParam);
+                }
+                if (_recorder != nullptr) {
+                    quint32 address = done.burst.address + static_cast<quint32>(target.offset*REGISTER_SIZE);
+                    _recorder->record(_board, address, data[target.offset], TelemetryFormat::KIND_READ);
+                }
+            }
+        }
+    });
+    if (error != AUDIO_SUCCESS) {
+        transfer.pending = false;
+    }
+}
+
+void Updater::writeBurst(int index)
+{
+    WriteTransfer &transfer = _writeTransfers[index];
+    if (transfer.lastWrite.isValid() && (transfer.lastWrite.elapsed() < _writeIntervalMs)) {
+        return;
+    }
+
+    const BurstPlanner::Burst &burst = transfer.burst;
+    _writeVector.resize(burst.length);
+    _dirtyVector.fill(false, burst.length);
+    foreach (const BurstPlanner::Target &target, burst.targets) {
+        unsigned int writeParam = 0;
+        Element &entry = _elementVector[target.element];
+        entry.element->updateParam(&writeParam);
+        // changes are recorded, and the current values again after every
+        // resync, so a query finds the fader positions close to its range
+        if ((_recorder != nullptr) && (!entry.shadowValid || (entry.value != writeParam))) {
+            _recorder->record(_board, entry.address, writeParam, TelemetryFormat::KIND_WRITE);
+        }
+        entry.value = writeParam;
+        _writeVector[target.offset] = writeParam;
+        if (!entry.shadowValid || (entry.shadow != writeParam)) {
+            _dirtyVector[target.offset] = true;
+        }
+    }
+
+    // only send the runs of registers that changed
+    int offset = 0;
+    while (offset < burst.length) {
+        if (!_dirtyVector[offset]) {
+            offset++;
+            continue;
+        }
+        int first = offset;
+        while ((offset < burst.length) && _dirtyVector[offset]) {
+            offset++;
+        }
+        writeRun(index, first, offset-first);
+        transfer.lastWrite.start();
+    }
+}
+
+void Updater::writeRun(int index, int offset, int length)
+{
+    const BurstPlanner::Burst &burst = _writeTransfers[index].burst;
+    _runVector.resize(length);
+    for (int word=0; word<length; word++) {
+        _runVector[word] = _writeVector[offset+word];
+    }
+    quint32 address = burst.address + static_cast<quint32>(offset*REGISTER_SIZE);
+
+    // the elements remember what this write sends, the value may change
+    // again before the response arrives
+    quint16 write = ++_writeCount;
+    foreach (const BurstPlanner::Target &target, burst.targets) {
+        if ((target.offset >= offset) && (target.offset < offset+length)) {
+            Element &entry = _elementVector[target.element];
+            entry.sent = _runVector[target.offset-offset];
+            entry.sentWrite = write;
+        }
+    }
+
+    // keep the capture within the small buffer of std::function, it does not allocate then
+    qint16 transfer = static_cast<qint16>(index);
+    qint16 first = static_cast<qint16>(offset);
+    qint16 count = static_cast<qint16>(length);
+    // plan() waits for the response, the index stays valid
+    _writeTransfers[index].pending++;
+    int error = _registerAccess->writeAsync(address, _runVector, [this, transfer, first, count, write](int writeError) {
+        _writeTransfers[transfer].pending--;
+        if (writeError == AUDIO_SUCCESS) {
+            verifyRun(transfer, first, count, write);
+        }
+    });
+    if (error != AUDIO_SUCCESS) {
+        _writeTransfers[index].pending--;
+    }
+}
+
+void Updater::verifyRun(int index, int offset, int length, quint16 write)
+{
+    // the firmware does not acknowledge writes, success only means the
+    // packet was sent. the run is read back, a lost write stays dirty and
+    // is sent again with the next burst
+    const BurstPlanner::Burst &burst = _writeTransfers[index].burst;
+    quint32 address = burst.address + static_cast<quint32>(offset*REGISTER_SIZE);
+    for (int word=0; word<length; word++) {
+        if (!RegisterMap::isSideEffectFree(address + static_cast<quint32>(word*REGISTER_SIZE))) {
+            // reading would change the register, the sent values are trusted
+            confirmRun(index, offset, length, write, nullptr);
+            return;
+        }
+    }
+
+    qint16 transfer = static_cast<qint16>(index);
+    qint16 first = static_cast<qint16>(offset);
+    qint16 count = static_cast<qint16>(length);
+    _writeTransfers[index].pending++;
+    int error = _registerAccess->readAsync(address, length, [this, transfer, first, count, write](int readError, const quint32 *data, int readLength) {
+        _writeTransfers[transfer].pending--;
+        if ((readError == AUDIO_SUCCESS) && (readLength >= count)) {
+            confirmRun(transfer, first, count, write, data);
+        }
+    });
+    if (error != AUDIO_SUCCESS) {
+        _writeTransfers[index].pending--;
+    }
+}
+
+void Updater::confirmRun(int index, int offset, int length, quint16 write, const quint32 *data)
+{
+    // data holds the read back run, nullptr if it was not read
+    foreach (const BurstPlanner::Target &target, _writeTransfers[index].burst.targets) {
+        if ((target.offset < offset) || (target.offset >= offset+length)) {
+            continue;
+        }
+        // a later write of the element answers for itself
+        Element &entry = _elementVector[target.element];
+        if (entry.sentWrite != write) {
+            continue;
+        }
+        quint32 mask = RegisterMap::getMask(entry.address);
+        if ((data != nullptr) && ((data[target.offset-offset] & mask) != (entry.sent & mask))) {
+            continue;
+        }
+        entry.shadow = entry.sent;
+        entry.shadowValid = true;
+    }
+}
@@ -0,0 +1,115 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 20.01.2019
+// Filename  : updater.h
+// Changelog : 20.01.2019 - file created
+//             17.10.2026 - asynchronous update
+//             17.10.2026 - burst transfers
+//             17.10.2026 - write on change
+//             17.10.2026 - external update tick
+//             17.10.2026 - telemetry recording
+//             17.10.2026 - typed registers of the register map
+//             17.10.2026 - scene capture and recall
+//             17.10.2026 - suspended writes for the automation
+//             18.10.2026 - plan kept while writes are pending
+//             18.10.2026 - shadow takes the value sent
+//             18.10.2026 - written registers read back
+//             18.10.2026 - recall deferred while writes are suspended
+//------------------------------------------------------------------------------
+
+#ifndef UPDATER_H
+#define UPDATER_H
+
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QVector>
+
+#include "iregisteraccess.h"
+#include "iupdateelement.h"
+#include "burstplanner.h"
+#include "registermap.h"
+#include "scene.h"
+#include "telemetryrecorder.h"
+
+class Updater : public QObject
+{
+    Q_OBJECT
+
+public:
+    Updater(IRegisterAccess *registerAccess, QObject *parent);
+    void addElement(uint address, IUpdateElement *element, bool read);
+    template <typename R>
+    void addRegister(IUpdateElement *element)
+    {
+        // read only registers are polled, the others are written
+        addElement(R::address(), element, R::readOnly());
+    }
+    void setInterval(int intervalMs);
+    void setMaxReadGap(int words);
+    void setWriteInterval(int intervalMs);
+    void setResyncInterval(int intervalMs);
+    void invalidateShadow();
+    void setRecorder(TelemetryRecorder *recorder, int board);
+    void captureScene(Scene &scene);
+    void recallScene(const Scene &scene);
+    bool isRecallPending();
+    void invalidateSceneShadow();
+    void acknowledgeScene(const Scene &scene);
+    void setWritesSuspended(bool suspended);
+
+public slots:
+    void update();
+
+private:
+    struct Element {
+        IUpdateElement *element;
+        quint32         address;
+        bool            read;
+        quint32         value;        // last value of the element
+        quint32         sent;         // value of the last write sent
+        quint16         sentWrite;    // number of that write
+        quint32         shadow;       // last value the board read back
+        bool            shadowValid;
+    };
+
+    struct ReadTransfer {
+        BurstPlanner::Burst burst;
+        bool                pending;
+    };
+
+    struct WriteTransfer {
+        BurstPlanner::Burst burst;
+        QElapsedTimer       lastWrite;
+        int                 pending;      // writes without response
+    };
+
+    void plan();
+    void readBurst(int index);
+    void writeBurst(int index);
+    void writeRun(int index, int offset, int length);
+    void verifyRun(int index, int offset, int length, quint16 write);
+    void confirmRun(int index, int offset, int length, quint16 write, const quint32 *data);
+
+    QTimer                       _timer;
+    QVector<Element>             _elementVector;
+    QVector<ReadTransfer>        _readTransfers;
+    QVector<WriteTransfer>       _writeTransfers;
+    QVector<quint32>             _writeVector;
+    QVector<quint32>             _runVector;
+    QVector<bool>                _dirtyVector;
+    QElapsedTimer                _resyncTimer;
+    Scene                        _sceneShadow;  // registers written by scenes without element
+    Scene                        _suspendedScene;  // recalled while writes were suspended
+    int                          _recallPending;
+    quint16                      _writeCount;
+    bool                         _writesSuspended;
+    bool                         _planRequired;
+    int                          _maxReadGap;
+    int                          _writeIntervalMs;
+    int                          _resyncIntervalMs;
+    IRegisterAccess              *_registerAccess;
+    TelemetryRecorder            *_recorder;
+    int                          _board;
+};
+
+#endif // UPDATER_H
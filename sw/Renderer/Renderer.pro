@@ -0,0 +1,55 @@
+#-------------------------------------------------
+#
+# Offline renderer with a bit exact model of the
+# audio_top signal chain
+#
+#-------------------------------------------------
+
+QT       += core
+QT       += concurrent
+QT       -= gui
+
+TARGET = Renderer
+TEMPLATE = app
+CONFIG += console
+CONFIG -= app_bundle
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+CONFIG += c++11
+
+# the coefficients are prepared with the classes of the Core library
+include(../Core/core.pri)
+
+SOURCES += \
+    main.cpp \
+    logcosrom.cpp \
+    crossfadermodel.cpp \
+    metermodel.cpp \
+    biquadmodel.cpp \
+    convolutionmodel.cpp \
+    audiochain.cpp \
+    samplefile.cpp \
+    renderer.cpp \
+    fft.cpp \
+    partitionedconvolver.cpp \
+    truncationanalysis.cpp
+
+HEADERS += \
+    fixedpoint.h \
+    logcosrom.h \
+    crossfadermodel.h \
+    metermodel.h \
+    biquadmodel.h \
+    convolutionmodel.h \
+    audiochain.h \
+    samplefile.h \
+    renderer.h \
+    fft.h \
+    partitionedconvolver.h \
+    truncationanalysis.h
+
+# Default rules for deployment.
+qnx: target.path = /tmp/$${TARGET}/bin
+else: unix:!android: target.path = /opt/$${TARGET}/bin
+!isEmpty(target.path): INSTALLS += target
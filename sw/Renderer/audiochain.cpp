@@ -0,0 +1,129 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : audiochain.cpp
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#include "audiochain.h"
+#include <QtConcurrent>
+
+AudioChain::AudioChain(int biquadCount) :
+    _biquad{BiquadModel(biquadCount), BiquadModel(biquadCount)},
+    _biquadEnabled(false),
+    _parallelChannels(false)
+{
+}
+
+void AudioChain::reset()
+{
+    for (int channel=0; channel<CHANNEL_COUNT; channel++) {
+        _inputMeter[channel].read();
+        _outputMeter[channel].read();
+        _biquad[channel].reset();
+        _convolution[channel].reset();
+    }
+    _inputFader.reset();
+    _convolutionFader.reset();
+}
+
+void AudioChain::presetLevels(int inputLevel, int convolutionLevel)
+{
+    _inputFader.preset(inputLevel, inputLevel);
+    _convolutionFader.preset(convolutionLevel, convolutionLevel);
+}
+
+void AudioChain::setInputLevel(int leftLevel, int rightLevel)
+{
+    _inputFader.setLevel(leftLevel, rightLevel);
+}
+
+void AudioChain::setConvolutionLevel(int leftLevel, int rightLevel)
+{
+    _convolutionFader.setLevel(leftLevel, rightLevel);
+}
+
+void AudioChain::setFirCoefficients(int channel, const quint32 *coefficients, int count)
+{
+    // convolution.vhd has one coefficient ram for both channels, separate
+    // responses are modelled for the banks of CoefficientLoader
+    _convolution[channel].setCoefficients(coefficients, count);
+}
+
+void AudioChain::setBiquadCoefficients(int channel, int biquad, const quint32 *words)
+{
+    _biquad[channel].setCoefficients(biquad, words);
+}
+
+void AudioChain::setBiquadEnabled(bool enable)
+{
+    _biquadEnabled = enable;
+}
+
+void AudioChain::setNoiseShaping(bool enable)
+{
+    for (int channel=0; channel<CHANNEL_COUNT; channel++) {
+        _biquad[channel].setNoiseShaping(enable);
+    }
+}
+
+void AudioChain::setVectorized(bool enable)
+{
+    for (int channel=0; channel<CHANNEL_COUNT; channel++) {
+        _convolution[channel].setVectorized(enable);
+    }
+}
+
+void AudioChain::setParallelChannels(bool enable)
+{
+    // the caller must not itself run on a saturated global thread pool
+    _parallelChannels = enable;
+}
+
+MeterModel &AudioChain::getInputMeter(int channel)
+{
+    return _inputMeter[channel];
+}
+
+MeterModel &AudioChain::getOutputMeter(int channel)
+{
+    return _outputMeter[channel];
+}
+
+void AudioChain::process(const qint32 *inLeft, const qint32 *inRight, qint32 *outLeft, qint32 *outRight, int frames)
+{
+    for (int channel=0; channel<CHANNEL_COUNT; channel++) {
+        _faded[channel].resize(frames);
+        _wet[channel].resize(frames);
+    }
+
+    // the faders couple the channels through the shared fade position, the
+    // filters in between run on each channel on their own
+    _inputMeter[LEFT].process(inLeft, frames);
+    _inputMeter[RIGHT].process(inRight, frames);
+    _inputFader.process(inLeft, inRight, nullptr, nullptr, _faded[LEFT].data(), _faded[RIGHT].data(), frames);
+
+    if (_parallelChannels) {
+        QFuture<void> right = QtConcurrent::run([this, frames]() { processChannel(RIGHT, frames); });
+        processChannel(LEFT, frames);
+        right.waitForFinished();
+    } else {
+        processChannel(LEFT, frames);
+        processChannel(RIGHT, frames);
+    }
+
+    _convolutionFader.process(_wet[LEFT].constData(), _wet[RIGHT].constData(),
+                              _faded[LEFT].constData(), _faded[RIGHT].constData(), outLeft, outRight, frames);
+    _outputMeter[LEFT].process(outLeft, frames);
+    _outputMeter[RIGHT].process(outRight, frames);
+}
+
+void AudioChain::processChannel(int channel, int frames)
+{
+    qint32 *samples = _wet[channel].data();
+    memcpy(samples, _faded[channel].constData(), static_cast<size_t>(frames)*sizeof(qint32));
+    if (_biquadEnabled) {
+        _biquad[channel].process(samples, frames);
+    }
+    _convolution[channel].process(samples, frames);
+}
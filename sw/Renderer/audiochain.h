@@ -0,0 +1,67 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : audiochain.h
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#ifndef AUDIOCHAIN_H
+#define AUDIOCHAIN_H
+
+#include <QVector>
+#include "crossfadermodel.h"
+#include "metermodel.h"
+#include "biquadmodel.h"
+#include "convolutionmodel.h"
+
+// signal chain of audio_top.vhd for one stereo stream
+//
+// input meter, input fader, convolution, convolution bypass fader with the
+// faded input as slave and output meter. audio_top does not instantiate
+// biquad.vhd yet, the cascade is an optional stage in front of the
+// convolution and disabled by default
+class AudioChain
+{
+
+public:
+    enum Channel {
+        LEFT  = 0,
+        RIGHT = 1
+    };
+
+    AudioChain(int biquadCount);
+
+    void reset();
+    void presetLevels(int inputLevel, int convolutionLevel);
+    void setInputLevel(int leftLevel, int rightLevel);
+    void setConvolutionLevel(int leftLevel, int rightLevel);
+    void setFirCoefficients(int channel, const quint32 *coefficients, int count);
+    void setBiquadCoefficients(int channel, int biquad, const quint32 *words);
+    void setBiquadEnabled(bool enable);
+    void setNoiseShaping(bool enable);
+    void setVectorized(bool enable);
+    void setParallelChannels(bool enable);
+
+    void process(const qint32 *inLeft, const qint32 *inRight, qint32 *outLeft, qint32 *outRight, int frames);
+
+    MeterModel &getInputMeter(int channel);
+    MeterModel &getOutputMeter(int channel);
+
+    static const int CHANNEL_COUNT = 2;
+
+private:
+    void processChannel(int channel, int frames);
+
+    CrossfaderModel  _inputFader;
+    CrossfaderModel  _convolutionFader;
+    MeterModel       _inputMeter[CHANNEL_COUNT];
+    MeterModel       _outputMeter[CHANNEL_COUNT];
+    BiquadModel      _biquad[CHANNEL_COUNT];
+    ConvolutionModel _convolution[CHANNEL_COUNT];
+    QVector<qint32>  _faded[CHANNEL_COUNT];
+    QVector<qint32>  _wet[CHANNEL_COUNT];
+    bool             _biquadEnabled;
+    bool             _parallelChannels;
+};
+
+#endif // AUDIOCHAIN_H
@@ -0,0 +1,96 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : biquadmodel.cpp
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#include "biquadmodel.h"
+#include "biquaddesigner.h"
+#include "fixedpoint.h"
+
+static const int     DATA_BITS     = BiquadDesigner::COEFFICIENT_BITS;
+static const int     FRACTION_BITS = BiquadDesigner::FRACTION_BITS;
+static const qint64  FRACTION_MASK = (1ll << FRACTION_BITS) - 1;
+static const qint64  SUM_MAX       = (1ll << 47) - 1;
+static const qint64  SUM_MIN       = -(1ll << 47);
+
+BiquadModel::BiquadModel(int biquadCount) :
+    _sections(biquadCount),
+    _noiseShaping(true)
+{
+    // bypass sections until a curve is set, like BiquadUploader starts out
+    quint32 words[BiquadDesigner::WORDS_PER_BIQUAD];
+    BiquadDesigner::Band band = {BiquadDesigner::TYPE_BYPASS, 1000.0, 0.0, 0.707};
+    BiquadDesigner::quantize(BiquadDesigner::design(band, 48000.0), words);
+    for (int biquad=0; biquad<biquadCount; biquad++) {
+        setCoefficients(biquad, words);
+    }
+    reset();
+}
+
+void BiquadModel::setCoefficients(int biquad, const quint32 *words)
+{
+    Section &section = _sections[biquad];
+    section.b0 = FixedPoint::wrap(words[BiquadDesigner::OFFSET_B0], DATA_BITS);
+    section.b1 = FixedPoint::wrap(words[BiquadDesigner::OFFSET_B1], DATA_BITS);
+    section.b2 = FixedPoint::wrap(words[BiquadDesigner::OFFSET_B2], DATA_BITS);
+    section.minusA1 = FixedPoint::wrap(words[BiquadDesigner::OFFSET_MINUS_A1], DATA_BITS);
+    section.minusA2 = FixedPoint::wrap(words[BiquadDesigner::OFFSET_MINUS_A2], DATA_BITS);
+}
+
+void BiquadModel::setNoiseShaping(bool enable)
+{
+    _noiseShaping = enable;
+}
+
+void BiquadModel::reset()
+{
+    for (int biquad=0; biquad<_sections.length(); biquad++) {
+        _sections[biquad].s1 = 0;
+        _sections[biquad].s2 = 0;
+        _sections[biquad].y = 0;
+    }
+}
+
+int BiquadModel::getBiquadCount()
+{
+    return _sections.length();
+}
+
+void BiquadModel::process(qint32 *samples, int frames)
+{
+    Section *sections = _sections.data();
+    int count = _sections.length();
+    for (int frame=0; frame<frames; frame++) {
+        qint64 x = samples[frame];
+        for (int biquad=0; biquad<count; biquad++) {
+            Section &section = sections[biquad];
+
+            // the truncated fraction of the last result is fed back, the
+            // ones complement for negative results
+            qint64 shaping = 0;
+            if (_noiseShaping) {
+                shaping = (section.y >= 0) ? (section.y & FRACTION_MASK) : (-1 - (section.y & FRACTION_MASK));
+            }
+            qint64 accumulator = FixedPoint::wrap(shaping + section.b0*x, STATE_BITS);
+            qint64 sum = accumulator + section.s1;
+            switch ((sum >> 47) & 3) {
+                case 1 :
+                    section.y = SUM_MAX;
+                    break;
+                case 2 :
+                    section.y = SUM_MIN;
+                    break;
+                default :
+                    section.y = FixedPoint::wrap(sum, STATE_BITS);
+            }
+            qint64 y = FixedPoint::wrap(section.y >> FRACTION_BITS, DATA_BITS);
+
+            section.s1 = FixedPoint::wrap(section.b1*x + section.minusA1*y + section.s2, STATE_BITS);
+            section.s2 = FixedPoint::wrap(section.b2*x + section.minusA2*y, STATE_BITS);
+            x = y;
+        }
+        samples[frame] = FixedPoint::wrap24(x);
+    }
+}
@@ -0,0 +1,52 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : biquadmodel.h
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#ifndef BIQUADMODEL_H
+#define BIQUADMODEL_H
+
+#include <QtGlobal>
+#include <QVector>
+
+// sample exact model of the biquad.vhd cascade of one channel
+//
+// transposed direct form II with 27 bit coefficients and data, 54 bit
+// state and the first order noise shaping of NOISE_SHAPING_EN. the sum
+// saturates on bit 48 like the hardware does. the noise shaping feeds back
+// the inverted fraction of negative results, so even a bypass section is
+// one lsb off after a negative sample
+class BiquadModel
+{
+
+public:
+    BiquadModel(int biquadCount);
+
+    // coefficients in the memory layout of BiquadDesigner::quantize()
+    void setCoefficients(int biquad, const quint32 *words);
+    void setNoiseShaping(bool enable);
+    void reset();
+    void process(qint32 *samples, int frames);
+    int  getBiquadCount();
+
+    static const int STATE_BITS = 54;
+
+private:
+    struct Section {
+        qint64 b0;
+        qint64 b1;
+        qint64 b2;
+        qint64 minusA1;
+        qint64 minusA2;
+        qint64 s1;
+        qint64 s2;
+        qint64 y;      // full width result, source of the noise shaping
+    };
+
+    QVector<Section> _sections;
+    bool             _noiseShaping;
+};
+
+#endif // BIQUADMODEL_H
@@ -0,0 +1,155 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : convolutionmodel.cpp
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#include "convolutionmodel.h"
+#include "fixedpoint.h"
+
+// the avx2 path is compiled for x86 with gcc or clang and selected at run
+// time, everything else takes the scalar loop
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define CONVOLUTION_AVX2
+#include <immintrin.h>
+#endif
+
+static const qint64 SUM_MAX  = (1ll << (ConvolutionModel::ACCUMULATOR_BITS-1)) - 1;
+static const qint64 SUM_MIN  = -(1ll << (ConvolutionModel::ACCUMULATOR_BITS-1));
+static const qint64 SUM_MASK = (1ll << ConvolutionModel::ACCUMULATOR_BITS) - 1;
+static const int    TOP_BITS = ConvolutionModel::ACCUMULATOR_BITS - 2;
+
+ConvolutionModel::ConvolutionModel() :
+    _coefficients(ACTIVE_TAP_COUNT, 0),
+    _partialSums(ACTIVE_TAP_COUNT+1, 0),
+    _vectorized(isVectorSupported())
+{
+    // a unit impulse until real coefficients are loaded
+    _coefficients[0] = FixedPoint::MAX_24;
+}
+
+void ConvolutionModel::setCoefficients(const quint32 *coefficients, int count)
+{
+    for (int tap=0; tap<ACTIVE_TAP_COUNT; tap++) {
+        _coefficients[tap] = (tap < count) ? FixedPoint::wrap(coefficients[tap], COEFFICIENT_BITS) : 0;
+    }
+}
+
+void ConvolutionModel::reset()
+{
+    _partialSums.fill(0);
+}
+
+void ConvolutionModel::setVectorized(bool enable)
+{
+    _vectorized = enable && isVectorSupported();
+}
+
+bool ConvolutionModel::isVectorized()
+{
+    return _vectorized;
+}
+
+bool ConvolutionModel::isVectorSupported()
+{
+#ifdef CONVOLUTION_AVX2
+    static bool supported = __builtin_cpu_supports("avx2");
+    return supported;
+#else
+    return false;
+#endif
+}
+
+void ConvolutionModel::process(qint32 *samples, int frames)
+{
+    if (_vectorized) {
+        processVector(samples, frames);
+    } else {
+        processScalar(samples, frames);
+    }
+}
+
+static inline qint32 truncateSum(qint64 sum)
+{
+    // add_r(46 downto 23) when the 6 top bits agree, saturated otherwise
+    qint64 top = sum >> (ConvolutionModel::ACCUMULATOR_BITS-6);
+    if ((top == 0) || (top == -1)) {
+        return FixedPoint::wrap24(sum >> 23);
+    }
+    return (sum < 0) ? FixedPoint::MIN_24 : FixedPoint::MAX_24;
+}
+
+void ConvolutionModel::processScalar(qint32 *samples, int frames)
+{
+    const qint64 *coefficients = _coefficients.constData();
+    qint64 *sums = _partialSums.data();
+    for (int frame=0; frame<frames; frame++) {
+        qint64 x = samples[frame];
+        // ascending taps read the next partial sum before it is replaced
+        for (int tap=0; tap<ACTIVE_TAP_COUNT; tap++) {
+            qint64 previous = sums[tap+1];
+            qint64 sum = FixedPoint::wrap(coefficients[tap]*x + previous, ACCUMULATOR_BITS);
+            // the hardware compares the two top bits of the sum and the old partial sum
+            int sumTop = static_cast<int>((sum >> TOP_BITS) & 3);
+            int previousTop = static_cast<int>((previous >> TOP_BITS) & 3);
+            if ((sumTop == 2) && (previousTop == 1)) {
+                sum = SUM_MAX;
+            } else if ((sumTop == 1) && (previousTop == 2)) {
+                sum = SUM_MIN;
+            }
+            sums[tap] = sum;
+        }
+        samples[frame] = truncateSum(sums[0]);
+    }
+}
+
+#ifdef CONVOLUTION_AVX2
+
+__attribute__((target("avx2")))
+static void processAvx2(const qint64 *coefficients, qint64 *sums, qint32 *samples, int frames, int taps)
+{
+    // four 64 bit lanes, the 24 bit operands fit the signed 32 x 32 multiply
+    // and the wrap to 52 bits is done with mask, xor and subtract as avx2
+    // has no arithmetic 64 bit shift
+    const __m256i sumMask = _mm256_set1_epi64x(SUM_MASK);
+    const __m256i signBit = _mm256_set1_epi64x(1ll << (ConvolutionModel::ACCUMULATOR_BITS-1));
+    const __m256i maxSum = _mm256_set1_epi64x(SUM_MAX);
+    const __m256i minSum = _mm256_set1_epi64x(SUM_MIN);
+    const __m256i one = _mm256_set1_epi64x(1);
+    const __m256i two = _mm256_set1_epi64x(2);
+    const __m256i three = _mm256_set1_epi64x(3);
+
+    for (int frame=0; frame<frames; frame++) {
+        const __m256i x = _mm256_set1_epi64x(samples[frame]);
+        for (int tap=0; tap<taps; tap+=4) {
+            __m256i coefficient = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(coefficients+tap));
+            __m256i previous = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(sums+tap+1));
+            __m256i sum = _mm256_add_epi64(_mm256_mul_epi32(coefficient, x), previous);
+            sum = _mm256_sub_epi64(_mm256_xor_si256(_mm256_and_si256(sum, sumMask), signBit), signBit);
+
+            __m256i sumTop = _mm256_and_si256(_mm256_srli_epi64(sum, TOP_BITS), three);
+            __m256i previousTop = _mm256_and_si256(_mm256_srli_epi64(previous, TOP_BITS), three);
+            __m256i overflow = _mm256_and_si256(_mm256_cmpeq_epi64(sumTop, two), _mm256_cmpeq_epi64(previousTop, one));
+            __m256i underflow = _mm256_and_si256(_mm256_cmpeq_epi64(sumTop, one), _mm256_cmpeq_epi64(previousTop, two));
+            sum = _mm256_blendv_epi8(sum, maxSum, overflow);
+            sum = _mm256_blendv_epi8(sum, minSum, underflow);
+
+            // the stored lanes were read already, the next group reads from tap+5 on
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(sums+tap), sum);
+        }
+        samples[frame] = truncateSum(sums[0]);
+    }
+}
+
+#endif
+
+void ConvolutionModel::processVector(qint32 *samples, int frames)
+{
+#ifdef CONVOLUTION_AVX2
+    static_assert((ACTIVE_TAP_COUNT % 4) == 0, "taps are processed in groups of four");
+    processAvx2(_coefficients.constData(), _partialSums.data(), samples, frames, ACTIVE_TAP_COUNT);
+#else
+    processScalar(samples, frames);
+#endif
+}
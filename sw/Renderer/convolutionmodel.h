@@ -0,0 +1,50 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : convolutionmodel.h
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#ifndef CONVOLUTIONMODEL_H
+#define CONVOLUTIONMODEL_H
+
+#include <QtGlobal>
+#include <QVector>
+
+// sample exact model of convolution.vhd for one channel
+//
+// the hardware keeps one partial sum per tap in the data ram and adds the
+// weighted new sample to the partial sum of the next tap (transposed fir).
+// the sums are 52 bit wide, 4 guard bits above the 48 bit product, and
+// saturate on overflow. the address counter stops at 462, so only the first
+// 460 of the 512 coefficients take part
+class ConvolutionModel
+{
+
+public:
+    ConvolutionModel();
+
+    // 24 bit words as written to the coefficient ram
+    void setCoefficients(const quint32 *coefficients, int count);
+    void reset();
+    void process(qint32 *samples, int frames);
+    void setVectorized(bool enable);
+    bool isVectorized();
+
+    static bool isVectorSupported();
+
+    static const int TAP_COUNT        = 512;
+    static const int ACTIVE_TAP_COUNT = 460;
+    static const int COEFFICIENT_BITS = 24;
+    static const int ACCUMULATOR_BITS = 52;
+
+private:
+    void   processScalar(qint32 *samples, int frames);
+    void   processVector(qint32 *samples, int frames);
+
+    QVector<qint64> _coefficients;
+    QVector<qint64> _partialSums;   // one more than the taps, the last stays 0
+    bool            _vectorized;
+};
+
+#endif // CONVOLUTIONMODEL_H
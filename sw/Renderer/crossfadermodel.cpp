@@ -0,0 +1,117 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : crossfadermodel.cpp
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#include "crossfadermodel.h"
+#include "fixedpoint.h"
+#include "logcosrom.h"
+
+static const int LEFT  = 0;
+static const int RIGHT = 1;
+
+CrossfaderModel::CrossfaderModel()
+{
+    reset();
+}
+
+void CrossfaderModel::reset()
+{
+    // power up state of the registers
+    for (int channel=0; channel<2; channel++) {
+        _address[channel] = 0;
+        _oldAddress[channel] = 0;
+        _nextLevel[channel] = 0;
+    }
+    _cosAddress = COS_END;
+    _fadeInProgress = false;
+    _levelChanged = false;
+}
+
+void CrossfaderModel::preset(int leftLevel, int rightLevel)
+{
+    // as after power up with the level written once and the fade completed,
+    // the end of the cosine is slightly below one so the gain is not exactly
+    // the one of the level
+    reset();
+    _nextLevel[LEFT] = leftLevel & LEVEL_MASK;
+    _nextLevel[RIGHT] = rightLevel & LEVEL_MASK;
+    loadLevel();
+    _cosAddress = COS_END;
+    _fadeInProgress = false;
+}
+
+void CrossfaderModel::setLevel(int leftLevel, int rightLevel)
+{
+    // a change during a fade is applied when the fade has ended
+    _nextLevel[LEFT] = leftLevel & LEVEL_MASK;
+    _nextLevel[RIGHT] = rightLevel & LEVEL_MASK;
+    if (_fadeInProgress) {
+        _levelChanged = true;
+    } else {
+        loadLevel();
+    }
+}
+
+bool CrossfaderModel::isFading()
+{
+    return _fadeInProgress;
+}
+
+void CrossfaderModel::loadLevel()
+{
+    for (int channel=0; channel<2; channel++) {
+        _oldAddress[channel] = _address[channel];
+        _address[channel] = _nextLevel[channel];
+    }
+    _cosAddress = COS_START;
+    _fadeInProgress = true;
+    _levelChanged = false;
+}
+
+void CrossfaderModel::process(const qint32 *masterLeft, const qint32 *masterRight,
+                              const qint32 *slaveLeft, const qint32 *slaveRight,
+                              qint32 *outLeft, qint32 *outRight, int frames)
+{
+    for (int frame=0; frame<frames; frame++) {
+        qint32 left = processSample(LEFT, masterLeft[frame], (slaveLeft != nullptr) ? slaveLeft[frame] : 0);
+        qint32 right = processSample(RIGHT, masterRight[frame], (slaveRight != nullptr) ? slaveRight[frame] : 0);
+        outLeft[frame] = left;
+        outRight[frame] = right;
+    }
+}
+
+qint32 CrossfaderModel::processSample(int channel, qint32 master, qint32 slave)
+{
+    // fader_proc advances the fade with the valid, the calculation sees the new position
+    if (_cosAddress != COS_END) {
+        _cosAddress++;
+    } else {
+        _fadeInProgress = false;
+    }
+    qint32 cosine = LogCosRom::get(_cosAddress >> 1);
+
+    // the slave address is 200 - level in 8 bits
+    qint32 slaveGain = gain((LogCosRom::COSINE_START - _oldAddress[channel]) & LEVEL_MASK,
+                            (LogCosRom::COSINE_START - _address[channel]) & LEVEL_MASK, cosine);
+    qint32 masterGain = gain(_oldAddress[channel], _address[channel], cosine);
+    qint32 result = FixedPoint::wrap24(static_cast<qint64>(FixedPoint::multiply24(masterGain, master)) +
+                                       FixedPoint::multiply24(slaveGain, slave));
+
+    // the pending level is loaded once the calculation is done
+    if (_levelChanged && !_fadeInProgress) {
+        loadLevel();
+    }
+    return result;
+}
+
+qint32 CrossfaderModel::gain(int oldAddress, int newAddress, qint32 cosine)
+{
+    // old + (new - old) * cos, every step truncated to 24 bits
+    qint32 oldLevel = LogCosRom::get(oldAddress);
+    qint32 newLevel = LogCosRom::get(newAddress);
+    qint32 difference = FixedPoint::wrap24(static_cast<qint64>(newLevel) - oldLevel);
+    return FixedPoint::wrap24(static_cast<qint64>(FixedPoint::multiply24(difference, cosine)) + oldLevel);
+}
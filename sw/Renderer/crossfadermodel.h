@@ -0,0 +1,54 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : crossfadermodel.h
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#ifndef CROSSFADERMODEL_H
+#define CROSSFADERMODEL_H
+
+#include <QtGlobal>
+
+// sample exact model of crossfader.vhd
+//
+// the level is the attenuation of the master in 0.5 dB steps, the slave
+// gets the complementary level. a level change fades along the cosine part
+// of the rom, both channels share the fade position which advances on
+// every left and right sample
+class CrossfaderModel
+{
+
+public:
+    CrossfaderModel();
+
+    void reset();
+    void preset(int leftLevel, int rightLevel);
+    void setLevel(int leftLevel, int rightLevel);
+    bool isFading();
+
+    // one frame is processed left first like i2s_inout delivers it, a
+    // missing slave is the unconnected input of the input fader
+    void process(const qint32 *masterLeft, const qint32 *masterRight,
+                 const qint32 *slaveLeft, const qint32 *slaveRight,
+                 qint32 *outLeft, qint32 *outRight, int frames);
+
+    static const int LEVEL_MASK = 0xff;
+
+private:
+    qint32 processSample(int channel, qint32 master, qint32 slave);
+    qint32 gain(int oldAddress, int newAddress, qint32 cosine);
+    void   loadLevel();
+
+    static const int COS_START = 400;   // rom address 200, begin of the cosine
+    static const int COS_END   = 511;
+
+    int  _address[2];
+    int  _oldAddress[2];
+    int  _nextLevel[2];
+    int  _cosAddress;
+    bool _fadeInProgress;
+    bool _levelChanged;
+};
+
+#endif // CROSSFADERMODEL_H
@@ -0,0 +1,148 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : fft.cpp
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#include "fft.h"
+#include <QtMath>
+
+Fft::Fft(int size) :
+    _size(size),
+    _half(size/2),
+    _bitReverse(size/2),
+    _twiddles(size/2),
+    _rotation(size+2),
+    _work(size)
+{
+    int bits = 0;
+    while ((1 << bits) < _half) {
+        bits++;
+    }
+    for (int index=0; index<_half; index++) {
+        int reversed = 0;
+        for (int bit=0; bit<bits; bit++) {
+            if (index & (1 << bit)) {
+                reversed |= 1 << (bits-1-bit);
+            }
+        }
+        _bitReverse[index] = reversed;
+    }
+    // the angles are calculated in double, float sin/cos of large sizes drift
+    for (int k=0; k<_half/2; k++) {
+        double angle = -2.0 * M_PI * k / _half;
+        _twiddles[2*k] = static_cast<float>(qCos(angle));
+        _twiddles[2*k+1] = static_cast<float>(qSin(angle));
+    }
+    for (int k=0; k<=_half; k++) {
+        double angle = -2.0 * M_PI * k / _size;
+        _rotation[2*k] = static_cast<float>(qCos(angle));
+        _rotation[2*k+1] = static_cast<float>(qSin(angle));
+    }
+}
+
+int Fft::nextPowerOfTwo(int value)
+{
+    int size = 1;
+    while (size < value) {
+        size <<= 1;
+    }
+    return size;
+}
+
+int Fft::getSize()
+{
+    return _size;
+}
+
+int Fft::getBinCount()
+{
+    return _half + 1;
+}
+
+void Fft::transform(float *data, bool inverse)
+{
+    // iterative radix 2, in place on interleaved complex values
+    for (int index=0; index<_half; index++) {
+        int reversed = _bitReverse[index];
+        if (reversed > index) {
+            qSwap(data[2*index], data[2*reversed]);
+            qSwap(data[2*index+1], data[2*reversed+1]);
+        }
+    }
+    const float sign = inverse ? -1.0f : 1.0f;
+    for (int length=2; length<=_half; length<<=1) {
+        int step = _half / length;
+        int middle = length / 2;
+        for (int start=0; start<_half; start+=length) {
+            for (int k=0; k<middle; k++) {
+                float wr = _twiddles[2*k*step];
+                float wi = sign * _twiddles[2*k*step+1];
+                float *a = data + 2*(start+k);
+                float *b = data + 2*(start+k+middle);
+                float tr = b[0]*wr - b[1]*wi;
+                float ti = b[0]*wi + b[1]*wr;
+                b[0] = a[0] - tr;
+                b[1] = a[1] - ti;
+                a[0] += tr;
+                a[1] += ti;
+            }
+        }
+    }
+}
+
+void Fft::forward(const float *input, float *spectrum)
+{
+    // even samples as real, odd samples as imaginary part
+    float *z = _work.data();
+    memcpy(z, input, static_cast<size_t>(_size)*sizeof(float));
+    transform(z, false);
+
+    // X[k] = E[k] + W^k O[k] with E and O taken apart from Z[k] and conj(Z[half-k])
+    for (int k=0; k<=_half; k++) {
+        int index = (k == _half) ? 0 : k;
+        int mirror = (k == 0) ? 0 : _half-k;
+        float zr = z[2*index];
+        float zi = z[2*index+1];
+        float mr = z[2*mirror];
+        float mi = -z[2*mirror+1];
+        float er = 0.5f * (zr + mr);
+        float ei = 0.5f * (zi + mi);
+        // (Z - conj(Zm)) / 2j
+        float orr = 0.5f * (zi - mi);
+        float oi = -0.5f * (zr - mr);
+        float wr = _rotation[2*k];
+        float wi = _rotation[2*k+1];
+        spectrum[2*k] = er + (orr*wr - oi*wi);
+        spectrum[2*k+1] = ei + (orr*wi + oi*wr);
+    }
+}
+
+void Fft::inverse(const float *spectrum, float *output)
+{
+    float *z = _work.data();
+    for (int k=0; k<_half; k++) {
+        float xr = spectrum[2*k];
+        float xi = spectrum[2*k+1];
+        float mr = spectrum[2*(_half-k)];
+        float mi = -spectrum[2*(_half-k)+1];
+        float er = 0.5f * (xr + mr);
+        float ei = 0.5f * (xi + mi);
+        // (X - conj(Xm)) / 2 * conj(W^k)
+        float dr = 0.5f * (xr - mr);
+        float di = 0.5f * (xi - mi);
+        float wr = _rotation[2*k];
+        float wi = -_rotation[2*k+1];
+        float orr = dr*wr - di*wi;
+        float oi = dr*wi + di*wr;
+        // Z = E + jO
+        z[2*k] = er - oi;
+        z[2*k+1] = ei + orr;
+    }
+    transform(z, true);
+    const float scale = 1.0f / _half;
+    for (int index=0; index<_size; index++) {
+        output[index] = z[index] * scale;
+    }
+}
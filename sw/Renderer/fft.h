@@ -0,0 +1,43 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : fft.h
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#ifndef FFT_H
+#define FFT_H
+
+#include <QVector>
+
+// real valued fft of a power of two size
+//
+// the spectrum holds the size/2+1 bins from dc to nyquist as interleaved
+// real and imaginary parts. the real transform is done as a complex one of
+// half the size. the inverse is scaled, inverse(forward(x)) gives x back.
+// the tables and the work buffer belong to the object, use one per thread
+class Fft
+{
+
+public:
+    Fft(int size);
+
+    void forward(const float *input, float *spectrum);
+    void inverse(const float *spectrum, float *output);
+    int  getSize();
+    int  getBinCount();
+
+    static int nextPowerOfTwo(int value);
+
+private:
+    void transform(float *data, bool inverse);
+
+    int            _size;
+    int            _half;
+    QVector<int>   _bitReverse;
+    QVector<float> _twiddles;   // e^-j2pik/half for the complex transform
+    QVector<float> _rotation;   // e^-j2pik/size to split the half size result
+    QVector<float> _work;
+};
+
+#endif // FFT_H
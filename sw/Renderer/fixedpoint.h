@@ -0,0 +1,41 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : fixedpoint.h
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#ifndef FIXEDPOINT_H
+#define FIXEDPOINT_H
+
+#include <QtGlobal>
+
+// two's complement helpers behaving like numeric_std signed vectors
+class FixedPoint
+{
+
+public:
+    // keep the lower bits and sign extend, like resize() of a wider result
+    static inline qint64 wrap(qint64 value, int bits)
+    {
+        const quint64 mask = (bits >= 64) ? ~0ull : ((1ull << bits) - 1);
+        const quint64 sign = 1ull << (bits-1);
+        return static_cast<qint64>((static_cast<quint64>(value) & mask) ^ sign) - static_cast<qint64>(sign);
+    }
+
+    static inline qint32 wrap24(qint64 value)
+    {
+        return static_cast<qint32>(wrap(value, 24));
+    }
+
+    // product(46 downto 23) of two 24 bit values
+    static inline qint32 multiply24(qint32 a, qint32 b)
+    {
+        return wrap24((static_cast<qint64>(a) * b) >> 23);
+    }
+
+    static const qint32 MAX_24 = (1 << 23) - 1;
+    static const qint32 MIN_24 = -(1 << 23);
+};
+
+#endif // FIXEDPOINT_H
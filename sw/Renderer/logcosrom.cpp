@@ -0,0 +1,33 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : logcosrom.cpp
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#include "logcosrom.h"
+#include <QtMath>
+#include <cmath>
+
+qint32 LogCosRom::get(int address)
+{
+    return table()[address & (SIZE-1)];
+}
+
+const qint32 *LogCosRom::table()
+{
+    // evaluated in the same order as init_lookup_table_f, round() of
+    // math_real rounds halfway cases away from zero like std::round
+    static qint32 values[SIZE];
+    static bool initialized = [] {
+        for (int i=0; i<LEVEL_COUNT; i++) {
+            values[i] = static_cast<qint32>(std::round(std::pow(10.0, static_cast<double>(-i)/40.0) * (std::pow(2.0, 23) - 1.0)));
+        }
+        for (int i=COSINE_START; i<SIZE; i++) {
+            values[i] = static_cast<qint32>(std::round((2.0 - (1.0 + std::cos(M_PI*static_cast<double>(i-COSINE_START)/55.0))) * (std::pow(2.0, 22) - 1.0)));
+        }
+        return true;
+    }();
+    Q_UNUSED(initialized);
+    return values;
+}
@@ -0,0 +1,28 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : logcosrom.h
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#ifndef LOGCOSROM_H
+#define LOGCOSROM_H
+
+#include <QtGlobal>
+
+// contents of log_cos_data_rom.vhd, shared by the crossfader and the meter
+class LogCosRom
+{
+
+public:
+    static qint32 get(int address);
+
+    static const int SIZE         = 256;
+    static const int LEVEL_COUNT  = 200;    // 0 dB to -100 dB in 0.5 dB steps
+    static const int COSINE_START = 200;    // rising half cosine up to the end
+
+private:
+    static const qint32 *table();
+};
+
+#endif // LOGCOSROM_H
@@ -0,0 +1,267 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : main.cpp
+// Changelog : 17.10.2026 - file created
+//             17.10.2026 - untruncated preview and truncation report
+//------------------------------------------------------------------------------
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QRegularExpression>
+#include <QTextStream>
+#include "renderer.h"
+#include "convolutionmodel.h"
+#include "impulseresponse.h"
+#include "truncationanalysis.h"
+#include "typedefinitions.h"
+
+static int loadFirPackage(QString fileName, QVector<quint32> &coefficients)
+{
+    // the step_response_c constant of step_response_pkg.vhd, e.g. 0 => x"060FCD"
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return AUDIO_FILE_ERROR;
+    }
+    QString content = QString::fromLatin1(file.readAll());
+    QRegularExpression entry("(\\d+)\\s*=>\\s*x\"([0-9a-fA-F]{6})\"");
+    coefficients.fill(0, ConvolutionModel::TAP_COUNT);
+    int found = 0;
+    QRegularExpressionMatchIterator match = entry.globalMatch(content);
+    while (match.hasNext()) {
+        QRegularExpressionMatch tap = match.next();
+        int index = tap.captured(1).toInt();
+        if (index < ConvolutionModel::TAP_COUNT) {
+            coefficients[index] = tap.captured(2).toUInt(nullptr, 16);
+            found++;
+        }
+    }
+    return (found > 0) ? AUDIO_SUCCESS : AUDIO_FILE_FORMAT_ERROR;
+}
+
+static ImpulseResponse::Normalization toNormalization(QString normalization)
+{
+    if (normalization == "peak") {
+        return ImpulseResponse::NORMALIZE_PEAK;
+    } else if (normalization == "sum") {
+        return ImpulseResponse::NORMALIZE_SUM;
+    }
+    return ImpulseResponse::NORMALIZE_NONE;
+}
+
+static int loadFir(QString fileName, ImpulseResponse::Normalization normalization, QVector<quint32> &coefficients,
+                   ImpulseResponse &response)
+{
+    // the response stays empty for a package, it has the table only
+    if (QFileInfo(fileName).suffix().toLower() == "vhd") {
+        return loadFirPackage(fileName, coefficients);
+    }
+    int error = response.load(fileName);
+    if (error != AUDIO_SUCCESS) {
+        return error;
+    }
+    // the hardware uses the same coefficients for both channels
+    coefficients.resize(ConvolutionModel::TAP_COUNT);
+    response.quantize(0, normalization, coefficients.data(), ConvolutionModel::TAP_COUNT);
+    return AUDIO_SUCCESS;
+}
+
+static int writeTruncationReport(QString fileName, ImpulseResponse &response, ImpulseResponse::Normalization normalization)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        return AUDIO_FILE_ERROR;
+    }
+    QTextStream report(&file);
+    double sampleRate = (response.getSampleRate() > 0) ? response.getSampleRate() : 48000.0;
+    report << "# " << response.getLength() << " taps against the " << ConvolutionModel::ACTIVE_TAP_COUNT
+           << " taps the convolution uses, levels in dB" << endl;
+    for (int channel=0; channel<response.getChannelCount(); channel++) {
+        // the table is quantized like it is loaded, the long response gets the same scale
+        QVector<quint32> table(ConvolutionModel::TAP_COUNT);
+        response.quantize(channel, normalization, table.data(), ConvolutionModel::TAP_COUNT);
+        double scale = response.getScale(channel, normalization, ConvolutionModel::TAP_COUNT);
+        QVector<float> scaled = response.getChannel(channel);
+        for (int tap=0; tap<scaled.length(); tap++) {
+            scaled[tap] = static_cast<float>(scaled[tap] * scale);
+        }
+        report << "# channel " << channel << endl;
+        report << "# frequency response table error relative" << endl;
+        foreach (const TruncationAnalysis::Band &band, TruncationAnalysis::analyze(scaled.constData(), scaled.length(), table.constData(),
+                                                                                   ConvolutionModel::ACTIVE_TAP_COUNT, sampleRate)) {
+            report << QString::number(band.frequency, 'f', 1) << ' ' << QString::number(band.responseDb, 'f', 2) << ' '
+                   << QString::number(band.tableDb, 'f', 2) << ' ' << QString::number(band.errorDb, 'f', 2) << ' '
+                   << QString::number(band.relativeDb, 'f', 2) << endl;
+        }
+    }
+    return AUDIO_SUCCESS;
+}
+
+static bool parseBand(QString text, BiquadDesigner::Band &band)
+{
+    // type:frequency:gain:q
+    QStringList fields = text.split(':');
+    if (fields.length() != 4) {
+        return false;
+    }
+    QString type = fields[0].toLower();
+    if (type == "peak") {
+        band.type = BiquadDesigner::TYPE_PEAKING;
+    } else if (type == "lowshelf") {
+        band.type = BiquadDesigner::TYPE_LOW_SHELF;
+    } else if (type == "highshelf") {
+        band.type = BiquadDesigner::TYPE_HIGH_SHELF;
+    } else if (type == "lowpass") {
+        band.type = BiquadDesigner::TYPE_LOW_PASS;
+    } else if (type == "highpass") {
+        band.type = BiquadDesigner::TYPE_HIGH_PASS;
+    } else if (type == "notch") {
+        band.type = BiquadDesigner::TYPE_NOTCH;
+    } else if (type == "bypass") {
+        band.type = BiquadDesigner::TYPE_BYPASS;
+    } else {
+        return false;
+    }
+    bool frequencyValid = false;
+    bool gainValid = false;
+    bool qValid = false;
+    band.frequency = fields[1].toDouble(&frequencyValid);
+    band.gain = fields[2].toDouble(&gainValid);
+    band.q = fields[3].toDouble(&qValid);
+    return frequencyValid && gainValid && qValid;
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("Renderer");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Renders files through a bit exact model of the audio_top signal chain");
+    parser.addHelpOption();
+    parser.addPositionalArgument("files", "Input files, wav or text with one frame per line.", "files...");
+    QCommandLineOption outputOption("output-dir", "Directory of the rendered files.", "dir", ".");
+    QCommandLineOption formatOption("format", "Output format, wav or txt.", "format", "wav");
+    QCommandLineOption referenceOption("reference-dir", "Directory with captures of the same name to compare with.", "dir");
+    QCommandLineOption firOption("fir", "Impulse response, wav, raw float or step_response_pkg.vhd. Default is a unit impulse.", "file");
+    QCommandLineOption normalizationOption("normalization", "Impulse response normalization, none, peak or sum.", "mode", "none");
+    QCommandLineOption biquadOption("biquad", "Biquad band type:frequency:gain:q, repeat for more sections.", "band");
+    QCommandLineOption biquadsOption("biquads", "Number of biquad sections.", "count", "2");
+    QCommandLineOption noShapingOption("no-noise-shaping", "Model biquad.vhd with NOISE_SHAPING_EN false.");
+    QCommandLineOption inputLevelOption("input-level", "Input fader level in 0.5 dB steps.", "level", "0");
+    QCommandLineOption convolutionLevelOption("conv-level", "Convolution fader level, 0 convolution only, 200 bypassed.", "level", "0");
+    QCommandLineOption threadsOption("threads", "Number of worker threads, 0 for one per core.", "count", "0");
+    QCommandLineOption blockOption("block", "Frames per processing block.", "frames", "4096");
+    QCommandLineOption meterOption("meter-interval", "Meter read interval in milliseconds, 0 disables the meter log.", "ms", "0");
+    QCommandLineOption scalarOption("scalar", "Do not use the avx2 convolution.");
+    QCommandLineOption previewOption("preview", "Also render the untruncated --fir response to <name>.long.");
+    QCommandLineOption partitionOption("partition", "Block size of the untruncated convolution.", "frames", "64");
+    QCommandLineOption reportOption("truncation-report", "Write the error spectrum of the 512 tap table for --fir.", "file");
+    parser.addOptions({outputOption, formatOption, referenceOption, firOption, normalizationOption, biquadOption,
+                       biquadsOption, noShapingOption, inputLevelOption, convolutionLevelOption, threadsOption,
+                       blockOption, meterOption, scalarOption, previewOption, partitionOption, reportOption});
+    parser.process(app);
+
+    QTextStream out(stdout);
+    QTextStream err(stderr);
+    if (parser.positionalArguments().isEmpty() && !parser.isSet(reportOption)) {
+        parser.showHelp(1);
+    }
+
+    RenderSettings settings;
+    settings.inputLevel = parser.value(inputLevelOption).toInt();
+    settings.convolutionLevel = parser.value(convolutionLevelOption).toInt();
+    settings.biquadCount = qMax(1, parser.value(biquadsOption).toInt());
+    settings.noiseShaping = !parser.isSet(noShapingOption);
+    settings.vectorized = !parser.isSet(scalarOption);
+    settings.blockFrames = qMax(1, parser.value(blockOption).toInt());
+    settings.meterIntervalMs = parser.value(meterOption).toInt();
+    settings.partitionSize = qMax(1, parser.value(partitionOption).toInt());
+    ImpulseResponse response;
+    ImpulseResponse::Normalization normalization = toNormalization(parser.value(normalizationOption));
+    if (parser.isSet(firOption)) {
+        int error = loadFir(parser.value(firOption), normalization, settings.firCoefficients, response);
+        if (error != AUDIO_SUCCESS) {
+            err << parser.value(firOption) << ": " << QString(errorToString(error)) << endl;
+            return 1;
+        }
+    }
+    if ((parser.isSet(previewOption) || parser.isSet(reportOption)) && (response.getLength() == 0)) {
+        err << "preview and truncation report need a wav or raw response with --fir" << endl;
+        return 1;
+    }
+    if (parser.isSet(reportOption)) {
+        int error = writeTruncationReport(parser.value(reportOption), response, normalization);
+        if (error != AUDIO_SUCCESS) {
+            err << parser.value(reportOption) << ": " << QString(errorToString(error)) << endl;
+            return 1;
+        }
+    }
+    if (parser.isSet(previewOption)) {
+        // the preview uses the left response for both channels like the hardware table
+        double scale = response.getScale(0, normalization, ConvolutionModel::TAP_COUNT);
+        QVector<float> scaled = response.getChannel(0);
+        for (int tap=0; tap<scaled.length(); tap++) {
+            scaled[tap] = static_cast<float>(scaled[tap] * scale);
+        }
+        settings.longResponses.append(scaled);
+    }
+    foreach (const QString &text, parser.values(biquadOption)) {
+        BiquadDesigner::Band band;
+        if (!parseBand(text, band)) {
+            err << "invalid biquad band " << text << endl;
+            return 1;
+        }
+        settings.bands.append(band);
+    }
+
+    QDir outputDir(parser.value(outputOption));
+    QString suffix = (parser.value(formatOption) == "txt") ? ".txt" : ".wav";
+    QVector<RenderJob> jobs;
+    foreach (const QString &input, parser.positionalArguments()) {
+        RenderJob job;
+        QString baseName = QFileInfo(input).completeBaseName();
+        job.input = input;
+        job.output = outputDir.filePath(baseName + suffix);
+        job.preview = outputDir.filePath(baseName + ".long" + suffix);
+        if (parser.isSet(referenceOption)) {
+            QDir referenceDir(parser.value(referenceOption));
+            job.reference = referenceDir.filePath(baseName + ".txt");
+            if (!QFile::exists(job.reference)) {
+                job.reference = referenceDir.filePath(baseName + ".wav");
+            }
+        }
+        jobs.append(job);
+    }
+
+    Renderer renderer(settings);
+    renderer.render(jobs, parser.value(threadsOption).toInt());
+
+    int result = 0;
+    out << "convolution " << ((settings.vectorized && ConvolutionModel::isVectorSupported()) ? "avx2" : "scalar") << endl;
+    foreach (const RenderJob &job, jobs) {
+        if (job.error != AUDIO_SUCCESS) {
+            err << job.input << ": " << QString(errorToString(job.error)) << endl;
+            result = 1;
+            continue;
+        }
+        out << job.input << " -> " << job.output << ": " << job.frames << " frames in " << job.elapsedMs << " ms";
+        if (!settings.longResponses.isEmpty()) {
+            out << ", preview " << job.preview;
+        }
+        if (!job.reference.isEmpty()) {
+            if (job.mismatches > 0) {
+                out << ", " << job.mismatches << " samples differ from " << job.reference
+                    << ", first at frame " << job.firstMismatch;
+                result = 1;
+            } else {
+                out << ", matches " << job.reference;
+            }
+        }
+        out << endl;
+    }
+    return result;
+}
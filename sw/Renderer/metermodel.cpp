@@ -0,0 +1,57 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : metermodel.cpp
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#include "metermodel.h"
+#include "fixedpoint.h"
+#include "logcosrom.h"
+
+MeterModel::MeterModel() :
+    _peak(0)
+{
+}
+
+void MeterModel::process(const qint32 *samples, int frames)
+{
+    for (int frame=0; frame<frames; frame++) {
+        // the negation of the most negative value stays negative and never
+        // wins the signed compare
+        qint32 sample = samples[frame];
+        if (sample == FixedPoint::MIN_24) {
+            continue;
+        }
+        qint32 magnitude = (sample < 0) ? -sample : sample;
+        if (_peak < magnitude) {
+            _peak = magnitude;
+        }
+    }
+}
+
+int MeterModel::read()
+{
+    int level = getLevel();
+    _peak = 0;
+    return level;
+}
+
+int MeterModel::getLevel()
+{
+    // compare_proc keeps the last rom address above the peak, the rom falls
+    // monotonic so that is the end of the run from address 0
+    int level = 0;
+    for (int address=0; address<=MAX_LEVEL; address++) {
+        if (LogCosRom::get(address) <= _peak) {
+            break;
+        }
+        level = address;
+    }
+    return level;
+}
+
+qint32 MeterModel::getPeak()
+{
+    return _peak;
+}
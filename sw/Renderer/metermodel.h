@@ -0,0 +1,32 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : metermodel.h
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#ifndef METERMODEL_H
+#define METERMODEL_H
+
+#include <QtGlobal>
+
+// peak meter of meter.vhd for one channel, the level is the attenuation in
+// 0.5 dB steps the register would show, reading resets the peak
+class MeterModel
+{
+
+public:
+    MeterModel();
+
+    void    process(const qint32 *samples, int frames);
+    int     read();
+    int     getLevel();
+    qint32  getPeak();
+
+    static const int MAX_LEVEL = 198;  // last level compared before the strobe
+
+private:
+    qint32 _peak;
+};
+
+#endif // METERMODEL_H
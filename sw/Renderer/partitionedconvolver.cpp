@@ -0,0 +1,90 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : partitionedconvolver.cpp
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#include "partitionedconvolver.h"
+
+PartitionedConvolver::PartitionedConvolver(int blockSize) :
+    _fft(2*Fft::nextPowerOfTwo(blockSize)),
+    _blockSize(Fft::nextPowerOfTwo(blockSize)),
+    _binCount(_fft.getBinCount()),
+    _partitionCount(0),
+    _position(0),
+    _inputBuffer(2*_blockSize, 0.0f),
+    _accumulator(2*_binCount, 0.0f),
+    _outputBuffer(2*_blockSize, 0.0f)
+{
+    // a unit impulse until a response is set
+    float impulse = 1.0f;
+    setImpulseResponse(&impulse, 1);
+}
+
+void PartitionedConvolver::setImpulseResponse(const float *response, int length)
+{
+    // every partition is zero padded to twice the block size
+    _partitionCount = qMax(1, (length + _blockSize - 1) / _blockSize);
+    _partitions.fill(0.0f, _partitionCount*2*_binCount);
+    QVector<float> padded(2*_blockSize);
+    for (int partition=0; partition<_partitionCount; partition++) {
+        padded.fill(0.0f);
+        int offset = partition * _blockSize;
+        for (int sample=0; (sample < _blockSize) && (offset+sample < length); sample++) {
+            padded[sample] = response[offset+sample];
+        }
+        _fft.forward(padded.constData(), _partitions.data() + partition*2*_binCount);
+    }
+    _delayLine.fill(0.0f, _partitionCount*2*_binCount);
+    reset();
+}
+
+void PartitionedConvolver::reset()
+{
+    _inputBuffer.fill(0.0f);
+    _delayLine.fill(0.0f);
+    _position = 0;
+}
+
+int PartitionedConvolver::getBlockSize()
+{
+    return _blockSize;
+}
+
+int PartitionedConvolver::getPartitionCount()
+{
+    return _partitionCount;
+}
+
+void PartitionedConvolver::process(const float *input, float *output)
+{
+    // the transform sees the previous block followed by the new one
+    float *buffer = _inputBuffer.data();
+    memmove(buffer, buffer + _blockSize, static_cast<size_t>(_blockSize)*sizeof(float));
+    memcpy(buffer + _blockSize, input, static_cast<size_t>(_blockSize)*sizeof(float));
+
+    _position = (_position == 0) ? _partitionCount-1 : _position-1;
+    _fft.forward(buffer, _delayLine.data() + _position*2*_binCount);
+
+    // partition p meets the input spectrum of p blocks ago
+    float *accumulator = _accumulator.data();
+    memset(accumulator, 0, static_cast<size_t>(_accumulator.length())*sizeof(float));
+    const int spectrumSize = 2*_binCount;
+    for (int partition=0; partition<_partitionCount; partition++) {
+        int slot = _position + partition;
+        if (slot >= _partitionCount) {
+            slot -= _partitionCount;
+        }
+        const float *x = _delayLine.constData() + slot*spectrumSize;
+        const float *h = _partitions.constData() + partition*spectrumSize;
+        for (int bin=0; bin<spectrumSize; bin+=2) {
+            accumulator[bin] += x[bin]*h[bin] - x[bin+1]*h[bin+1];
+            accumulator[bin+1] += x[bin]*h[bin+1] + x[bin+1]*h[bin];
+        }
+    }
+
+    // the first half is wrapped around, the second half is the new output
+    _fft.inverse(accumulator, _outputBuffer.data());
+    memcpy(output, _outputBuffer.constData() + _blockSize, static_cast<size_t>(_blockSize)*sizeof(float));
+}
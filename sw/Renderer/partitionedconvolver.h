@@ -0,0 +1,45 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : partitionedconvolver.h
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#ifndef PARTITIONEDCONVOLVER_H
+#define PARTITIONEDCONVOLVER_H
+
+#include <QVector>
+#include "fft.h"
+
+// uniformly partitioned overlap save convolution of one channel
+//
+// the response is cut into partitions of the block size, each block of
+// input is transformed once and multiplied with all partition spectra
+// through a frequency domain delay line. the output of a block is ready
+// when the block was processed, there is no latency beyond the block
+class PartitionedConvolver
+{
+
+public:
+    PartitionedConvolver(int blockSize);
+
+    void setImpulseResponse(const float *response, int length);
+    void reset();
+    void process(const float *input, float *output);
+    int  getBlockSize();
+    int  getPartitionCount();
+
+private:
+    Fft            _fft;
+    int            _blockSize;
+    int            _binCount;
+    int            _partitionCount;
+    int            _position;       // delay line slot of the newest input spectrum
+    QVector<float> _partitions;     // spectra of the response partitions
+    QVector<float> _delayLine;      // spectra of the last inputs
+    QVector<float> _inputBuffer;    // previous and current block
+    QVector<float> _accumulator;
+    QVector<float> _outputBuffer;
+};
+
+#endif // PARTITIONEDCONVOLVER_H
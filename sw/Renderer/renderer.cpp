@@ -0,0 +1,178 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : renderer.cpp
+// Changelog : 17.10.2026 - file created
+//             17.10.2026 - partitioned convolution preview
+//------------------------------------------------------------------------------
+
+#include "renderer.h"
+#include "audiochain.h"
+#include "partitionedconvolver.h"
+#include "samplefile.h"
+#include "fixedpoint.h"
+#include "logcosrom.h"
+#include "typedefinitions.h"
+#include <QElapsedTimer>
+#include <QFile>
+#include <QThreadPool>
+#include <QtMath>
+#include <QtConcurrent>
+
+Renderer::Renderer(const RenderSettings &settings) :
+    _settings(settings)
+{
+}
+
+void Renderer::render(QVector<RenderJob> &jobs, int threads)
+{
+    if (threads > 0) {
+        QThreadPool::globalInstance()->setMaxThreadCount(threads);
+    }
+    if (jobs.length() == 1) {
+        // run on this thread so the channel split can use the pool
+        renderJob(jobs[0], QThreadPool::globalInstance()->maxThreadCount() > 1);
+        return;
+    }
+    QtConcurrent::blockingMap(jobs, [this](RenderJob &job) { renderJob(job, false); });
+}
+
+void Renderer::renderJob(RenderJob &job, bool parallelChannels)
+{
+    QElapsedTimer timer;
+    timer.start();
+    job.frames = 0;
+    job.mismatches = 0;
+    job.firstMismatch = -1;
+    job.elapsedMs = 0;
+
+    SampleFile input;
+    job.error = input.load(job.input);
+    if (job.error != AUDIO_SUCCESS) {
+        return;
+    }
+
+    AudioChain chain(_settings.biquadCount);
+    chain.presetLevels(_settings.inputLevel, _settings.convolutionLevel);
+    chain.setVectorized(_settings.vectorized);
+    chain.setParallelChannels(parallelChannels);
+    chain.setNoiseShaping(_settings.noiseShaping);
+    for (int channel=0; channel<AudioChain::CHANNEL_COUNT; channel++) {
+        if (!_settings.firCoefficients.isEmpty()) {
+            chain.setFirCoefficients(channel, _settings.firCoefficients.constData(), _settings.firCoefficients.length());
+        }
+        // designed for the rate of the file, the bands beyond the cascade are dropped
+        quint32 words[BiquadDesigner::WORDS_PER_BIQUAD];
+        for (int biquad=0; biquad<qMin(_settings.bands.length(), _settings.biquadCount); biquad++) {
+            BiquadDesigner::quantize(BiquadDesigner::design(_settings.bands[biquad], input.getSampleRate()), words);
+            chain.setBiquadCoefficients(channel, biquad, words);
+        }
+    }
+    chain.setBiquadEnabled(!_settings.bands.isEmpty());
+
+    int frames = input.getFrameCount();
+    SampleFile output;
+    output.setSampleRate(input.getSampleRate());
+    output.resize(frames);
+
+    // the meters are read like the gui polls them, each read resets the peak
+    QFile meterLog;
+    int meterFrames = static_cast<int>(static_cast<qint64>(_settings.meterIntervalMs) * input.getSampleRate() / 1000);
+    if (meterFrames > 0) {
+        meterLog.setFileName(job.output + ".meters.txt");
+        if (!meterLog.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+            job.error = AUDIO_FILE_ERROR;
+            return;
+        }
+        meterLog.write("# frame in_l in_r out_l out_r\n");
+    }
+
+    int frame = 0;
+    int nextMeterRead = meterFrames;
+    while (frame < frames) {
+        int count = qMin(_settings.blockFrames, frames-frame);
+        if (meterFrames > 0) {
+            count = qMin(count, nextMeterRead-frame);
+        }
+        chain.process(input.getChannel(AudioChain::LEFT)+frame, input.getChannel(AudioChain::RIGHT)+frame,
+                      output.getChannel(AudioChain::LEFT)+frame, output.getChannel(AudioChain::RIGHT)+frame, count);
+        frame += count;
+        if ((meterFrames > 0) && (frame == nextMeterRead)) {
+            meterLog.write(QByteArray::number(frame) + ' ' +
+                           QByteArray::number(chain.getInputMeter(AudioChain::LEFT).read()) + ' ' +
+                           QByteArray::number(chain.getInputMeter(AudioChain::RIGHT).read()) + ' ' +
+                           QByteArray::number(chain.getOutputMeter(AudioChain::LEFT).read()) + ' ' +
+                           QByteArray::number(chain.getOutputMeter(AudioChain::RIGHT).read()) + '\n');
+            nextMeterRead += meterFrames;
+        }
+    }
+    job.frames = frames;
+
+    job.error = output.save(job.output);
+    if ((job.error == AUDIO_SUCCESS) && !job.reference.isEmpty()) {
+        compare(job, output);
+    }
+    if ((job.error == AUDIO_SUCCESS) && !_settings.longResponses.isEmpty()) {
+        renderPreview(job, input);
+    }
+    job.elapsedMs = timer.elapsed();
+}
+
+void Renderer::renderPreview(RenderJob &job, SampleFile &input)
+{
+    // the convolution alone at the gain of the input fader, in float
+    double gain = (_settings.inputLevel < LogCosRom::LEVEL_COUNT) ? qPow(10.0, -_settings.inputLevel/40.0) : 0.0;
+    int frames = input.getFrameCount();
+    SampleFile preview;
+    preview.setSampleRate(input.getSampleRate());
+    preview.resize(frames);
+
+    for (int channel=0; channel<SampleFile::CHANNEL_COUNT; channel++) {
+        const QVector<float> &response = _settings.longResponses[qMin(channel, _settings.longResponses.length()-1)];
+        PartitionedConvolver convolver(_settings.partitionSize);
+        convolver.setImpulseResponse(response.constData(), response.length());
+        int blockSize = convolver.getBlockSize();
+        QVector<float> block(blockSize);
+        QVector<float> result(blockSize);
+        const qint32 *samples = input.getChannel(channel);
+        qint32 *rendered = preview.getChannel(channel);
+        for (int frame=0; frame<frames; frame+=blockSize) {
+            // the last block is padded with silence
+            int count = qMin(blockSize, frames-frame);
+            block.fill(0.0f);
+            for (int sample=0; sample<count; sample++) {
+                block[sample] = static_cast<float>(samples[frame+sample] * gain / 8388608.0);
+            }
+            convolver.process(block.constData(), result.data());
+            for (int sample=0; sample<count; sample++) {
+                double value = std::floor(result[sample] * 8388608.0 + 0.5);
+                rendered[frame+sample] = static_cast<qint32>(qBound(static_cast<double>(FixedPoint::MIN_24), value,
+                                                                    static_cast<double>(FixedPoint::MAX_24)));
+            }
+        }
+    }
+    job.error = preview.save(job.preview);
+}
+
+void Renderer::compare(RenderJob &job, const SampleFile &output)
+{
+    // a capture may start late or end early, only the common part is compared
+    SampleFile reference;
+    job.error = reference.load(job.reference);
+    if (job.error != AUDIO_SUCCESS) {
+        return;
+    }
+    qint64 frames = qMin(job.frames, static_cast<qint64>(reference.getFrameCount()));
+    for (int channel=0; channel<SampleFile::CHANNEL_COUNT; channel++) {
+        const qint32 *rendered = output.getChannel(channel);
+        const qint32 *expected = reference.getChannel(channel);
+        for (qint64 frame=0; frame<frames; frame++) {
+            if (rendered[frame] != expected[frame]) {
+                job.mismatches++;
+                if ((job.firstMismatch < 0) || (frame < job.firstMismatch)) {
+                    job.firstMismatch = frame;
+                }
+            }
+        }
+    }
+}
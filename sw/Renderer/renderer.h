@@ -0,0 +1,65 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : renderer.h
+// Changelog : 17.10.2026 - file created
+//             17.10.2026 - partitioned convolution preview
+//------------------------------------------------------------------------------
+
+#ifndef RENDERER_H
+#define RENDERER_H
+
+#include <QString>
+#include <QVector>
+#include "biquaddesigner.h"
+
+class SampleFile;
+
+struct RenderSettings {
+    int                          inputLevel;         // attenuation in 0.5 dB steps
+    int                          convolutionLevel;   // 0 is the convolution only
+    QVector<quint32>             firCoefficients;    // empty keeps the unit impulse
+    QVector<BiquadDesigner::Band> bands;             // empty leaves the cascade out
+    int                          biquadCount;
+    bool                         noiseShaping;
+    bool                         vectorized;
+    int                          blockFrames;
+    int                          meterIntervalMs;    // 0 disables the meter log
+    QVector<QVector<float>>      longResponses;      // untruncated, per channel, empty disables the preview
+    int                          partitionSize;
+};
+
+struct RenderJob {
+    QString input;
+    QString output;
+    QString reference;      // empty skips the comparison
+    QString preview;        // output of the untruncated response
+    int     error;
+    qint64  frames;
+    qint64  mismatches;
+    qint64  firstMismatch;
+    qint64  elapsedMs;
+};
+
+// renders files through AudioChain, the files are spread over the global
+// thread pool, a single file splits its channels instead
+//
+// with a long response the input is also rendered through a partitioned
+// fft convolution, to a/b the full response against the hardware table
+class Renderer
+{
+
+public:
+    Renderer(const RenderSettings &settings);
+
+    void render(QVector<RenderJob> &jobs, int threads);
+    void renderJob(RenderJob &job, bool parallelChannels);
+
+private:
+    void compare(RenderJob &job, const SampleFile &output);
+    void renderPreview(RenderJob &job, SampleFile &input);
+
+    RenderSettings _settings;
+};
+
+#endif // RENDERER_H
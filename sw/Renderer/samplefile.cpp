@@ -0,0 +1,226 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : samplefile.cpp
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#include "samplefile.h"
+#include "fixedpoint.h"
+#include "typedefinitions.h"
+#include <QFile>
+#include <QFileInfo>
+#include <QList>
+#include <QtEndian>
+#include <QtMath>
+
+SampleFile::SampleFile() :
+    _sampleRate(48000)
+{
+}
+
+bool SampleFile::isTextFile(QString fileName)
+{
+    QString suffix = QFileInfo(fileName).suffix().toLower();
+    return (suffix == "txt") || (suffix == "dat") || (suffix == "log");
+}
+
+int SampleFile::load(QString fileName)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return AUDIO_FILE_ERROR;
+    }
+    QByteArray content = file.readAll();
+    if (content.startsWith("RIFF")) {
+        return parseWav(content);
+    }
+    return parseText(content);
+}
+
+int SampleFile::parseWav(const QByteArray &file)
+{
+    const uchar *data = reinterpret_cast<const uchar *>(file.constData());
+    int size = file.size();
+    if ((size < 12) || (file.mid(8, 4) != "WAVE")) {
+        return AUDIO_FILE_FORMAT_ERROR;
+    }
+
+    int format = 0;
+    int channels = 0;
+    int bits = 0;
+    int sampleRate = 0;
+    int dataOffset = -1;
+    int dataSize = 0;
+    int offset = 12;
+    while (offset+8 <= size) {
+        QByteArray id = file.mid(offset, 4);
+        int chunkSize = static_cast<int>(qFromLittleEndian<quint32>(data+offset+4));
+        int body = offset + 8;
+        if ((chunkSize < 0) || (body+chunkSize > size)) {
+            chunkSize = size - body;
+        }
+        if ((id == "fmt ") && (chunkSize >= 16)) {
+            format = qFromLittleEndian<quint16>(data+body);
+            channels = qFromLittleEndian<quint16>(data+body+2);
+            sampleRate = static_cast<int>(qFromLittleEndian<quint32>(data+body+4));
+            bits = qFromLittleEndian<quint16>(data+body+14);
+            if ((format == 0xfffe) && (chunkSize >= 26)) {
+                format = qFromLittleEndian<quint16>(data+body+24);
+            }
+        } else if (id == "data") {
+            dataOffset = body;
+            dataSize = chunkSize;
+        }
+        offset = body + chunkSize + (chunkSize & 1);
+    }
+
+    bool pcm = (format == 1) && ((bits == 16) || (bits == 24) || (bits == 32));
+    bool ieeeFloat = (format == 3) && (bits == 32);
+    if ((dataOffset < 0) || (channels < 1) || (!pcm && !ieeeFloat)) {
+        return AUDIO_FILE_FORMAT_ERROR;
+    }
+
+    int sampleSize = bits / 8;
+    int frames = dataSize / (sampleSize*channels);
+    resize(frames);
+    const uchar *sample = data + dataOffset;
+    for (int frame=0; frame<frames; frame++) {
+        for (int channel=0; channel<channels; channel++) {
+            qint32 value;
+            if (ieeeFloat) {
+                quint32 raw = qFromLittleEndian<quint32>(sample);
+                float floatValue;
+                memcpy(&floatValue, &raw, sizeof(float));
+                double scaled = qBound(-1.0, static_cast<double>(floatValue), 1.0) * 8388608.0;
+                value = qMin(qFloor(scaled + 0.5), static_cast<int>(FixedPoint::MAX_24));
+            } else if (bits == 16) {
+                value = static_cast<qint32>(qFromLittleEndian<qint16>(sample)) * 256;
+            } else if (bits == 24) {
+                value = static_cast<qint32>((static_cast<quint32>(sample[2])<<24) | (static_cast<quint32>(sample[1])<<16) |
+                                            (static_cast<quint32>(sample[0])<<8)) >> 8;
+            } else {
+                // i2s_inout keeps the upper 24 bits of the slot
+                value = qFromLittleEndian<qint32>(sample) >> 8;
+            }
+            // further channels are dropped, a mono file feeds both
+            if (channel < CHANNEL_COUNT) {
+                _channels[channel][frame] = value;
+            }
+            sample += sampleSize;
+        }
+        if (channels == 1) {
+            _channels[1][frame] = _channels[0][frame];
+        }
+    }
+    _sampleRate = sampleRate;
+    return AUDIO_SUCCESS;
+}
+
+int SampleFile::parseText(const QByteArray &file)
+{
+    QList<QByteArray> lines = file.split('\n');
+    _channels[0].clear();
+    _channels[1].clear();
+    _channels[0].reserve(lines.length());
+    _channels[1].reserve(lines.length());
+    foreach (const QByteArray &line, lines) {
+        QByteArray trimmed = line.simplified();
+        if (trimmed.isEmpty() || trimmed.startsWith('#')) {
+            continue;
+        }
+        QList<QByteArray> columns = trimmed.split(' ');
+        bool leftValid = false;
+        bool rightValid = true;
+        qint64 left = columns[0].toLongLong(&leftValid, 0);
+        qint64 right = (columns.length() > 1) ? columns[1].toLongLong(&rightValid, 0) : left;
+        if (!leftValid || !rightValid) {
+            return AUDIO_FILE_FORMAT_ERROR;
+        }
+        // unsigned hex is taken as the 24 bit pattern
+        _channels[0].append(FixedPoint::wrap24(left));
+        _channels[1].append(FixedPoint::wrap24(right));
+    }
+    return _channels[0].isEmpty() ? AUDIO_FILE_FORMAT_ERROR : AUDIO_SUCCESS;
+}
+
+int SampleFile::save(QString fileName)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        return AUDIO_FILE_ERROR;
+    }
+    int frames = getFrameCount();
+
+    if (isTextFile(fileName)) {
+        QByteArray text;
+        text.reserve(frames*18);
+        for (int frame=0; frame<frames; frame++) {
+            text.append(QByteArray::number(_channels[0][frame]));
+            text.append(' ');
+            text.append(QByteArray::number(_channels[1][frame]));
+            text.append('\n');
+        }
+        return (file.write(text) == text.size()) ? AUDIO_SUCCESS : AUDIO_FILE_ERROR;
+    }
+
+    const int blockAlign = CHANNEL_COUNT * 3;
+    int dataSize = frames * blockAlign;
+    QByteArray wav(44 + dataSize, 0);
+    uchar *data = reinterpret_cast<uchar *>(wav.data());
+    memcpy(data, "RIFF", 4);
+    qToLittleEndian<quint32>(static_cast<quint32>(36 + dataSize), data+4);
+    memcpy(data+8, "WAVEfmt ", 8);
+    qToLittleEndian<quint32>(16, data+16);
+    qToLittleEndian<quint16>(1, data+20);
+    qToLittleEndian<quint16>(CHANNEL_COUNT, data+22);
+    qToLittleEndian<quint32>(static_cast<quint32>(_sampleRate), data+24);
+    qToLittleEndian<quint32>(static_cast<quint32>(_sampleRate*blockAlign), data+28);
+    qToLittleEndian<quint16>(blockAlign, data+32);
+    qToLittleEndian<quint16>(24, data+34);
+    memcpy(data+36, "data", 4);
+    qToLittleEndian<quint32>(static_cast<quint32>(dataSize), data+40);
+    uchar *sample = data + 44;
+    for (int frame=0; frame<frames; frame++) {
+        for (int channel=0; channel<CHANNEL_COUNT; channel++) {
+            quint32 value = static_cast<quint32>(_channels[channel][frame]);
+            sample[0] = static_cast<uchar>(value);
+            sample[1] = static_cast<uchar>(value >> 8);
+            sample[2] = static_cast<uchar>(value >> 16);
+            sample += 3;
+        }
+    }
+    return (file.write(wav) == wav.size()) ? AUDIO_SUCCESS : AUDIO_FILE_ERROR;
+}
+
+void SampleFile::resize(int frames)
+{
+    for (int channel=0; channel<CHANNEL_COUNT; channel++) {
+        _channels[channel].resize(frames);
+    }
+}
+
+int SampleFile::getFrameCount()
+{
+    return _channels[0].length();
+}
+
+int SampleFile::getSampleRate()
+{
+    return _sampleRate;
+}
+
+void SampleFile::setSampleRate(int sampleRate)
+{
+    _sampleRate = sampleRate;
+}
+
+qint32 *SampleFile::getChannel(int channel)
+{
+    return _channels[channel].data();
+}
+
+const qint32 *SampleFile::getChannel(int channel) const
+{
+    return _channels[channel].constData();
+}
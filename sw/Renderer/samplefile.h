@@ -0,0 +1,47 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : samplefile.h
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#ifndef SAMPLEFILE_H
+#define SAMPLEFILE_H
+
+#include <QString>
+#include <QVector>
+
+// stereo 24 bit samples as they travel over i2s
+//
+// wav files are read as pcm 16/24/32 bit or 32 bit float and written as
+// 24 bit pcm. text files hold one frame per line with the left and the
+// right sample as signed integers, decimal or 0x hex, like a testbench
+// writes them with textio. a single column is taken for both channels
+class SampleFile
+{
+
+public:
+    SampleFile();
+
+    int   load(QString fileName);
+    int   save(QString fileName);
+    void  resize(int frames);
+    int   getFrameCount();
+    int   getSampleRate();
+    void  setSampleRate(int sampleRate);
+    qint32       *getChannel(int channel);
+    const qint32 *getChannel(int channel) const;
+
+    static bool isTextFile(QString fileName);
+
+    static const int CHANNEL_COUNT = 2;
+
+private:
+    int   parseWav(const QByteArray &file);
+    int   parseText(const QByteArray &file);
+
+    QVector<qint32> _channels[CHANNEL_COUNT];
+    int             _sampleRate;
+};
+
+#endif // SAMPLEFILE_H
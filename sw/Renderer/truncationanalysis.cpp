@@ -0,0 +1,73 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : truncationanalysis.cpp
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#include "truncationanalysis.h"
+#include "fft.h"
+#include "fixedpoint.h"
+#include <QtMath>
+
+double TruncationAnalysis::toDb(double power)
+{
+    // -200 dB stands for no energy at all
+    return (power > 1e-20) ? 10.0*std::log10(power) : -200.0;
+}
+
+QVector<TruncationAnalysis::Band> TruncationAnalysis::analyze(const float *response, int length, const quint32 *table,
+                                                              int taps, double sampleRate)
+{
+    // at least 64k points keep the low third octaves apart
+    Fft fft(qMax(65536, Fft::nextPowerOfTwo(qMax(length, taps))));
+    QVector<float> signal(fft.getSize(), 0.0f);
+    QVector<float> responseSpectrum(2*fft.getBinCount());
+    QVector<float> tableSpectrum(2*fft.getBinCount());
+
+    memcpy(signal.data(), response, static_cast<size_t>(length)*sizeof(float));
+    fft.forward(signal.constData(), responseSpectrum.data());
+    signal.fill(0.0f);
+    for (int tap=0; tap<taps; tap++) {
+        signal[tap] = static_cast<float>(FixedPoint::wrap(table[tap], 24)) / 8388608.0f;
+    }
+    fft.forward(signal.constData(), tableSpectrum.data());
+
+    QVector<Band> bands;
+    double binWidth = sampleRate / fft.getSize();
+    for (int index=-17; ; index++) {
+        // base 10 third octaves around 1 kHz, 20 Hz up to nyquist
+        double center = 1000.0 * qPow(10.0, index/10.0);
+        double lower = center * qPow(10.0, -0.05);
+        double upper = center * qPow(10.0, 0.05);
+        if (upper > sampleRate/2) {
+            break;
+        }
+        int first = qMax(1, static_cast<int>(std::ceil(lower/binWidth)));
+        int last = qMin(fft.getBinCount()-1, static_cast<int>(std::floor(upper/binWidth)));
+        if (last < first) {
+            continue;
+        }
+        double responsePower = 0.0;
+        double tablePower = 0.0;
+        double errorPower = 0.0;
+        for (int bin=first; bin<=last; bin++) {
+            double hr = responseSpectrum[2*bin];
+            double hi = responseSpectrum[2*bin+1];
+            double tr = tableSpectrum[2*bin];
+            double ti = tableSpectrum[2*bin+1];
+            responsePower += hr*hr + hi*hi;
+            tablePower += tr*tr + ti*ti;
+            errorPower += (hr-tr)*(hr-tr) + (hi-ti)*(hi-ti);
+        }
+        int count = last - first + 1;
+        Band band;
+        band.frequency = center;
+        band.responseDb = toDb(responsePower/count);
+        band.tableDb = toDb(tablePower/count);
+        band.errorDb = toDb(errorPower/count);
+        band.relativeDb = band.errorDb - band.responseDb;
+        bands.append(band);
+    }
+    return bands;
+}
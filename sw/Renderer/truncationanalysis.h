@@ -0,0 +1,36 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : truncationanalysis.h
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#ifndef TRUNCATIONANALYSIS_H
+#define TRUNCATIONANALYSIS_H
+
+#include <QVector>
+
+// error spectrum of a long impulse response against the coefficient table
+// the convolution really uses, in third octave bands
+//
+// the table error contains the truncation as well as the 24 bit
+// quantization, relative is the error level below the long response
+class TruncationAnalysis
+{
+
+public:
+    struct Band {
+        double frequency;       // center, Hz
+        double responseDb;      // long response
+        double tableDb;         // coefficient table
+        double errorDb;         // difference of both
+        double relativeDb;      // error against the long response
+    };
+
+    static QVector<Band> analyze(const float *response, int length, const quint32 *table, int taps, double sampleRate);
+
+private:
+    static double toDb(double power);
+};
+
+#endif // TRUNCATIONANALYSIS_H
@@ -0,0 +1,38 @@
+#-------------------------------------------------
+#
+# Board simulator speaking the eth_ctrl protocol
+#
+#-------------------------------------------------
+
+QT       += core
+QT       += network
+QT       -= gui
+
+TARGET = Simulator
+TEMPLATE = app
+CONFIG += console
+CONFIG -= app_bundle
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+CONFIG += c++11
+
+# protocol constants are shared with the control client
+INCLUDEPATH += ../Core
+
+SOURCES += \
+    main.cpp \
+    virtualboard.cpp \
+    simulatorworker.cpp \
+    simulator.cpp
+
+HEADERS += \
+    virtualboard.h \
+    simulatorworker.h \
+    simulator.h \
+    ../Core/typedefinitions.h
+
+# Default rules for deployment.
+qnx: target.path = /tmp/$${TARGET}/bin
+else: unix:!android: target.path = /opt/$${TARGET}/bin
+!isEmpty(target.path): INSTALLS += target
@@ -0,0 +1,67 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : main.cpp
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QTextStream>
+#include "simulator.h"
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("Simulator");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Simulates audio boards speaking the eth_ctrl protocol");
+    parser.addHelpOption();
+    QCommandLineOption boardsOption("boards", "Number of virtual boards.", "count", "1");
+    QCommandLineOption baseOption("base", "Address of the first board.", "address", "127.0.1.1");
+    QCommandLineOption portOption("port", "UDP port of the boards.", "port", "4660");
+    QCommandLineOption threadsOption("threads", "Number of worker threads.", "count", "1");
+    QCommandLineOption latencyOption("latency", "Response delay in microseconds.", "us", "0");
+    QCommandLineOption jitterOption("jitter", "Random additional delay in microseconds.", "us", "0");
+    QCommandLineOption lossOption("loss", "Loss probability of requests and responses.", "rate", "0");
+    QCommandLineOption requestLossOption("request-loss", "Loss probability of requests.", "rate");
+    QCommandLineOption responseLossOption("response-loss", "Loss probability of responses.", "rate");
+    QCommandLineOption reorderOption("reorder", "Probability a response is held back.", "rate", "0");
+    QCommandLineOption reorderDelayOption("reorder-delay", "Delay of held back responses in microseconds.", "us", "5000");
+    QCommandLineOption timeoutOption("timeout", "Probability a read answers with read timeout.", "rate", "0");
+    QCommandLineOption reportOption("report", "Statistics interval in milliseconds, 0 disables.", "ms", "1000");
+    parser.addOptions({boardsOption, baseOption, portOption, threadsOption, latencyOption, jitterOption,
+                       lossOption, requestLossOption, responseLossOption, reorderOption, reorderDelayOption,
+                       timeoutOption, reportOption});
+    parser.process(app);
+
+    SimulatorSettings settings;
+    settings.port = static_cast<quint16>(parser.value(portOption).toUInt());
+    settings.latencyUs = parser.value(latencyOption).toInt();
+    settings.jitterUs = parser.value(jitterOption).toInt();
+    double loss = parser.value(lossOption).toDouble();
+    settings.requestLoss = parser.isSet(requestLossOption) ? parser.value(requestLossOption).toDouble() : loss;
+    settings.responseLoss = parser.isSet(responseLossOption) ? parser.value(responseLossOption).toDouble() : loss;
+    settings.reorderRate = parser.value(reorderOption).toDouble();
+    settings.reorderUs = parser.value(reorderDelayOption).toInt();
+    settings.timeoutRate = parser.value(timeoutOption).toDouble();
+
+    int boards = parser.value(boardsOption).toInt();
+    if (boards < 1) {
+        QTextStream(stderr) << "at least one board is required" << endl;
+        return 1;
+    }
+
+    Simulator simulator;
+    simulator.setReportInterval(parser.value(reportOption).toInt());
+    int threads = simulator.start(parser.value(baseOption), boards, parser.value(threadsOption).toInt(), settings);
+    if (threads < 0) {
+        QTextStream(stderr) << "invalid base address " << parser.value(baseOption) << endl;
+        return 1;
+    }
+    QTextStream(stdout) << boards << " boards from " << parser.value(baseOption) << " port " << settings.port
+                        << " on " << threads << " threads" << endl;
+
+    return app.exec();
+}
@@ -0,0 +1,105 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : simulator.cpp
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#include "simulator.h"
+#include <QHostAddress>
+#include <QTextStream>
+
+Simulator::Simulator(QObject *parent) :
+    QObject(parent),
+    _reportTimer(this),
+    _lastRequests(0),
+    _lastResponses(0),
+    _reportIntervalMs(1000)
+{
+    _statistics.requests = 0;
+    _statistics.responses = 0;
+    _statistics.writes = 0;
+    _statistics.timeouts = 0;
+    _statistics.dropped = 0;
+    _statistics.reordered = 0;
+    _statistics.invalid = 0;
+    connect(&_reportTimer, SIGNAL(timeout()), this, SLOT(report()));
+}
+
+Simulator::~Simulator()
+{
+    foreach (QThread *thread, _threads) {
+        thread->quit();
+        thread->wait();
+    }
+    // the workers are deleted by the finished signal of their thread
+    qDeleteAll(_threads);
+}
+
+int Simulator::start(const QString &baseAddress, int boardCount, int threadCount, const SimulatorSettings &settings)
+{
+    // boards use consecutive addresses, on linux the whole 127.0.0.0/8 is
+    // local, other systems need an alias per board on the loopback interface
+    QHostAddress base(baseAddress);
+    if (base.protocol() != QAbstractSocket::IPv4Protocol) {
+        return -1;
+    }
+    threadCount = qBound(1, threadCount, qMax(1, boardCount));
+
+    QVector<QStringList> addresses(threadCount);
+    for (int board=0; board<boardCount; board++) {
+        QHostAddress address(base.toIPv4Address() + static_cast<quint32>(board));
+        addresses[board % threadCount].append(address.toString());
+    }
+
+    for (int index=0; index<threadCount; index++) {
+        QThread *thread = new QThread();
+        SimulatorWorker *worker = new SimulatorWorker(addresses[index], settings, &_statistics);
+        worker->moveToThread(thread);
+        connect(thread, SIGNAL(started()), worker, SLOT(start()));
+        connect(thread, SIGNAL(finished()), worker, SLOT(deleteLater()));
+        connect(worker, SIGNAL(error(QString)), this, SLOT(workerError(QString)));
+        _threads.append(thread);
+        _workers.append(worker);
+        thread->start();
+    }
+
+    _reportTimer.start(_reportIntervalMs);
+    return threadCount;
+}
+
+void Simulator::setReportInterval(int intervalMs)
+{
+    _reportIntervalMs = intervalMs;
+    if (intervalMs > 0) {
+        _reportTimer.start(intervalMs);
+    } else {
+        _reportTimer.stop();
+    }
+}
+
+void Simulator::report()
+{
+    quint32 requests = _statistics.requests;
+    quint32 responses = _statistics.responses;
+    double seconds = _reportIntervalMs / 1000.0;
+
+    QTextStream out(stdout);
+    out << "requests " << requests
+        << " (" << qRound((requests - _lastRequests) / seconds) << "/s)"
+        << "  responses " << responses
+        << " (" << qRound((responses - _lastResponses) / seconds) << "/s)"
+        << "  writes " << _statistics.writes
+        << "  timeouts " << _statistics.timeouts
+        << "  dropped " << _statistics.dropped
+        << "  reordered " << _statistics.reordered
+        << "  invalid " << _statistics.invalid << endl;
+
+    _lastRequests = requests;
+    _lastResponses = responses;
+}
+
+void Simulator::workerError(QString message)
+{
+    QTextStream(stderr) << "bind failed " << message << endl;
+}
@@ -0,0 +1,43 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : simulator.h
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#ifndef SIMULATOR_H
+#define SIMULATOR_H
+
+#include <QObject>
+#include <QThread>
+#include <QTimer>
+#include <QVector>
+#include "simulatorworker.h"
+
+// distributes the virtual boards over worker threads and reports the load
+class Simulator : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit Simulator(QObject *parent = nullptr);
+    ~Simulator();
+
+    int  start(const QString &baseAddress, int boardCount, int threadCount, const SimulatorSettings &settings);
+    void setReportInterval(int intervalMs);
+
+private slots:
+    void report();
+    void workerError(QString message);
+
+private:
+    QVector<QThread*>          _threads;
+    QVector<SimulatorWorker*>  _workers;
+    SimulatorStatistics        _statistics;
+    QTimer                     _reportTimer;
+    quint32                    _lastRequests;
+    quint32                    _lastResponses;
+    int                        _reportIntervalMs;
+};
+
+#endif // SIMULATOR_H
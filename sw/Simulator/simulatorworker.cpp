@@ -0,0 +1,173 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : simulatorworker.cpp
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#include "simulatorworker.h"
+#include "typedefinitions.h"
+
+SimulatorWorker::SimulatorWorker(const QStringList &addresses, const SimulatorSettings &settings,
+                                 SimulatorStatistics *statistics, QObject *parent) :
+    QObject(parent),
+    _addresses(addresses),
+    _settings(settings),
+    _statistics(statistics),
+    _timer(nullptr),
+    _lastSignalUs(0),
+    _random(QRandomGenerator::global()->generate()),
+    _senderPort(0)
+{
+}
+
+SimulatorWorker::~SimulatorWorker()
+{
+    foreach (const Board &entry, _boards) {
+        delete entry.board;
+    }
+    foreach (Delayed *delayed, _delayed) {
+        delete delayed;
+    }
+    foreach (Delayed *delayed, _free) {
+        delete delayed;
+    }
+}
+
+void SimulatorWorker::start()
+{
+    // sockets and timer are created here to live in the worker thread
+    foreach (const QString &address, _addresses) {
+        Board entry;
+        entry.board = new VirtualBoard(_random.generate());
+        entry.socket = new QUdpSocket(this);
+        if (!entry.socket->bind(QHostAddress(address), _settings.port)) {
+            emit error(address + ": " + entry.socket->errorString());
+        }
+        connect(entry.socket, SIGNAL(readyRead()), this, SLOT(readyRead()));
+        _socketIndex.insert(entry.socket, _boards.length());
+        _boards.append(entry);
+    }
+
+    _clock.start();
+    _timer = new QTimer(this);
+    _timer->setTimerType(Qt::PreciseTimer);
+    connect(_timer, SIGNAL(timeout()), this, SLOT(tick()));
+    _timer->start(1);
+}
+
+void SimulatorWorker::readyRead()
+{
+    QUdpSocket *socket = qobject_cast<QUdpSocket *>(sender());
+    int index = _socketIndex.value(socket, -1);
+    if (index >= 0) {
+        receive(index);
+    }
+}
+
+void SimulatorWorker::receive(int index)
+{
+    QUdpSocket *socket = _boards[index].socket;
+    while (socket->hasPendingDatagrams()) {
+        qint64 size = socket->readDatagram(_datagram, sizeof(_datagram), &_sender, &_senderPort);
+        if (size < 1) {
+            continue;
+        }
+        _statistics->requests++;
+        if (chance(_settings.requestLoss)) {
+            _statistics->dropped++;
+            continue;
+        }
+
+        int responseSize = 0;
+        VirtualBoard::Result result = _boards[index].board->handlePacket(_datagram, static_cast<int>(size), _response, responseSize);
+        if (result == VirtualBoard::RESULT_NONE) {
+            // writes are not acknowledged by eth_ctrl
+            if ((size > 1) && (_datagram[1] == UDP_WRITE)) {
+                _statistics->writes++;
+            } else {
+                _statistics->invalid++;
+            }
+            continue;
+        }
+        if ((result == VirtualBoard::RESULT_RESPONSE) && chance(_settings.timeoutRate)) {
+            responseSize = _boards[index].board->makeTimeoutResponse(static_cast<quint8>(_datagram[0]), _response);
+            result = VirtualBoard::RESULT_TIMEOUT;
+        }
+        if (result == VirtualBoard::RESULT_TIMEOUT) {
+            _statistics->timeouts++;
+        }
+        if (chance(_settings.responseLoss)) {
+            _statistics->dropped++;
+            continue;
+        }
+        schedule(index, _sender, _senderPort, _response, responseSize);
+    }
+}
+
+void SimulatorWorker::schedule(int index, const QHostAddress &address, quint16 port, const char *data, int size)
+{
+    qint64 delayUs = _settings.latencyUs;
+    if (_settings.jitterUs > 0) {
+        delayUs += _random.bounded(_settings.jitterUs);
+    }
+    if (chance(_settings.reorderRate)) {
+        // later responses overtake this one
+        delayUs += _settings.reorderUs;
+        _statistics->reordered++;
+    }
+
+    if (delayUs <= 0) {
+        _boards[index].socket->writeDatagram(data, size, address, port);
+        _statistics->responses++;
+        return;
+    }
+
+    // delayed packets are recycled, the queue does not allocate once warmed up
+    Delayed *delayed = nullptr;
+    if (_free.isEmpty()) {
+        delayed = new Delayed();
+    } else {
+        delayed = _free.takeLast();
+    }
+    delayed->dueUs = (_clock.nsecsElapsed() / 1000) + delayUs;
+    delayed->board = index;
+    delayed->address = address;
+    delayed->port = port;
+    delayed->size = size;
+    memcpy(delayed->data, data, static_cast<size_t>(size));
+    _delayed.append(delayed);
+}
+
+void SimulatorWorker::tick()
+{
+    qint64 nowUs = _clock.nsecsElapsed() / 1000;
+
+    int index = 0;
+    while (index < _delayed.length()) {
+        Delayed *delayed = _delayed[index];
+        if (delayed->dueUs > nowUs) {
+            index++;
+            continue;
+        }
+        _boards[delayed->board].socket->writeDatagram(delayed->data, delayed->size, delayed->address, delayed->port);
+        _statistics->responses++;
+        // order within the queue does not matter, fill the gap with the last entry
+        _delayed[index] = _delayed.last();
+        _delayed.removeLast();
+        _free.append(delayed);
+    }
+
+    // audio level changes every 10 ms
+    if ((nowUs - _lastSignalUs) >= 10000) {
+        _lastSignalUs = nowUs;
+        foreach (const Board &entry, _boards) {
+            entry.board->updateSignal();
+        }
+    }
+}
+
+bool SimulatorWorker::chance(double probability)
+{
+    return (probability > 0.0) && (_random.generateDouble() < probability);
+}
@@ -0,0 +1,102 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : simulatorworker.h
+// Changelog : 17.10.2026 - file created
+//------------------------------------------------------------------------------
+
+#ifndef SIMULATORWORKER_H
+#define SIMULATORWORKER_H
+
+#include <QObject>
+#include <QUdpSocket>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QRandomGenerator>
+#include <QStringList>
+#include <QHash>
+#include <QVector>
+#include <atomic>
+#include "virtualboard.h"
+
+// network impairments applied by every worker
+struct SimulatorSettings {
+    quint16 port;
+    int     latencyUs;      // one way delay added to every response
+    int     jitterUs;       // random part of the delay
+    double  requestLoss;    // probability a request is dropped
+    double  responseLoss;   // probability a response is dropped
+    double  reorderRate;    // probability a response is held back
+    int     reorderUs;      // additional delay of a held back response
+    double  timeoutRate;    // probability a read answers with read timeout
+};
+
+// counters shared with the main thread
+struct SimulatorStatistics {
+    std::atomic<quint32> requests;
+    std::atomic<quint32> responses;
+    std::atomic<quint32> writes;
+    std::atomic<quint32> timeouts;
+    std::atomic<quint32> dropped;
+    std::atomic<quint32> reordered;
+    std::atomic<quint32> invalid;
+};
+
+// serves a group of virtual boards in its own thread
+class SimulatorWorker : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit SimulatorWorker(const QStringList &addresses, const SimulatorSettings &settings,
+                             SimulatorStatistics *statistics, QObject *parent = nullptr);
+    ~SimulatorWorker();
+
+signals:
+    void error(QString message);
+
+public slots:
+    void start();
+
+private slots:
+    void readyRead();
+    void tick();
+
+private:
+    struct Board {
+        VirtualBoard *board;
+        QUdpSocket   *socket;
+    };
+
+    // a response waiting for its delay to expire
+    struct Delayed {
+        qint64       dueUs;
+        int          board;
+        QHostAddress address;
+        quint16      port;
+        int          size;
+        char         data[VirtualBoard::MAX_PACKET_SIZE];
+    };
+
+    void    receive(int index);
+    void    schedule(int index, const QHostAddress &address, quint16 port, const char *data, int size);
+    bool    chance(double probability);
+
+    QStringList                _addresses;
+    SimulatorSettings          _settings;
+    SimulatorStatistics       *_statistics;
+    QVector<Board>             _boards;
+    QHash<QUdpSocket*, int>    _socketIndex;
+    QVector<Delayed*>          _delayed;
+    QVector<Delayed*>          _free;
+    QTimer                    *_timer;
+    QElapsedTimer              _clock;
+    qint64                     _lastSignalUs;
+    QRandomGenerator           _random;
+    char                       _datagram[VirtualBoard::MAX_PACKET_SIZE];
+    char                       _response[VirtualBoard::MAX_PACKET_SIZE];
+    QHostAddress               _sender;
+    quint16                    _senderPort;
+};
+
+#endif // SIMULATORWORKER_H
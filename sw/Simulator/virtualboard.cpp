@@ -0,0 +1,198 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : virtualboard.cpp
+// Changelog : 17.10.2026 - file created
+//             17.10.2026 - fir coefficient banks
+//             17.10.2026 - biquad coefficient memory
+//             18.10.2026 - signal walk in signed arithmetic
+//------------------------------------------------------------------------------
+
+#include "virtualboard.h"
+#include "typedefinitions.h"
+
+VirtualBoard::VirtualBoard(quint32 seed) :
+    _signalR(120),
+    _signalL(80),
+    _readCount(0),
+    _writeCount(0),
+    _random(seed)
+{
+    // register_init_c, register_read_only_c and register_mask_c of audio_top
+    for (int index=0; index<REGISTER_COUNT; index++) {
+        _registers[index] = 0;
+        _masks[index] = 0xffffffff;
+        _readOnly[index] = false;
+    }
+    for (int index=0; index<COEFFICIENT_COUNT; index++) {
+        _coefficients[index] = 0;
+    }
+    for (int index=0; index<BIQUAD_COUNT; index++) {
+        _biquadCoefficients[index] = 0;
+    }
+    _registers[VERSION] = 0xBEEF0123;
+    _readOnly[VERSION] = true;
+    const RegisterIndex byteRegisters[] = {IN_METER_R, IN_METER_L, IN_FADER_R, IN_FADER_L,
+                                           OUT_METER_R, OUT_METER_L, CONV_FADER_R, CONV_FADER_L};
+    for (RegisterIndex index : byteRegisters) {
+        _masks[index] = 0x000000ff;
+        _readOnly[index] = isMeter(index);
+    }
+    updateSignal();
+}
+
+VirtualBoard::Result VirtualBoard::handlePacket(const char *packet, int size, char *response, int &responseSize)
+{
+    responseSize = 0;
+    if (size < 3) {
+        return RESULT_NONE;
+    }
+    const uchar *byte = reinterpret_cast<const uchar *>(packet);
+    quint8 id = byte[0];
+    char command = packet[1];
+    int addressSize = byte[2];
+    if ((addressSize < 1) || (addressSize > 4) || (size < 3+addressSize+2)) {
+        return RESULT_NONE;
+    }
+
+    quint32 address = 0;
+    for (int index=0; index<addressSize; index++) {
+        address = (address<<8) | byte[3+index];
+    }
+    int offset = 3+addressSize;
+    int length = (byte[offset]<<8) | byte[offset+1];
+    offset += 2;
+
+    // the register bank sees the word address
+    quint32 index = address / REGISTER_SIZE;
+    int words = length / REGISTER_SIZE;
+
+    if (command == UDP_WRITE) {
+        if (size < offset+length) {
+            return RESULT_NONE;
+        }
+        for (int word=0; word<words; word++) {
+            quint32 value = (static_cast<quint32>(byte[offset])<<24) | (static_cast<quint32>(byte[offset+1])<<16) |
+                            (static_cast<quint32>(byte[offset+2])<<8) | static_cast<quint32>(byte[offset+3]);
+            writeRegister(index+static_cast<quint32>(word), value);
+            offset += REGISTER_SIZE;
+        }
+        _writeCount++;
+        return RESULT_NONE;
+    }
+
+    if (command != UDP_READ) {
+        return RESULT_NONE;
+    }
+    if ((4+length) > MAX_PACKET_SIZE) {
+        return RESULT_NONE;
+    }
+
+    _readCount++;
+    uchar *out = reinterpret_cast<uchar *>(response);
+    out[0] = id;
+    out[1] = static_cast<uchar>(UDP_READ_RESPONSE);
+    out[2] = static_cast<uchar>((length>>8) & 0xff);
+    out[3] = static_cast<uchar>(length & 0xff);
+    for (int word=0; word<words; word++) {
+        quint32 value = 0;
+        if (!readRegister(index+static_cast<quint32>(word), value)) {
+            // no acknowledge from the register bank, eth_ctrl times out
+            responseSize = makeTimeoutResponse(id, response);
+            return RESULT_TIMEOUT;
+        }
+        uchar *data = out + 4 + word*REGISTER_SIZE;
+        data[0] = static_cast<uchar>(value>>24);
+        data[1] = static_cast<uchar>(value>>16);
+        data[2] = static_cast<uchar>(value>>8);
+        data[3] = static_cast<uchar>(value);
+    }
+    responseSize = 4+length;
+    return RESULT_RESPONSE;
+}
+
+int VirtualBoard::makeTimeoutResponse(quint8 id, char *response)
+{
+    response[0] = static_cast<char>(id);
+    response[1] = UDP_READ_TIMEOUT;
+    response[2] = 0;
+    response[3] = 0;
+    return 4;
+}
+
+void VirtualBoard::updateSignal()
+{
+    // random walk of the input level, 0 = 0 dB, 2 steps per dB
+    // signed, a step below 0 must not wrap around to silence
+    _signalR = static_cast<quint32>(qBound(0, static_cast<int>(_signalR) + _random.bounded(11) - 5, 200));
+    _signalL = static_cast<quint32>(qBound(0, static_cast<int>(_signalL) + _random.bounded(11) - 5, 200));
+
+    // the meters keep the loudest value (lowest number) since the last read
+    _registers[IN_METER_R] = qMin(_registers[IN_METER_R], _signalR);
+    _registers[IN_METER_L] = qMin(_registers[IN_METER_L], _signalL);
+    quint32 outR = qMin(_signalR + _registers[IN_FADER_R] + _registers[CONV_FADER_R], 200u);
+    quint32 outL = qMin(_signalL + _registers[IN_FADER_L] + _registers[CONV_FADER_L], 200u);
+    _registers[OUT_METER_R] = qMin(_registers[OUT_METER_R], outR);
+    _registers[OUT_METER_L] = qMin(_registers[OUT_METER_L], outL);
+}
+
+quint32 VirtualBoard::getRegister(int index)
+{
+    return ((index >= 0) && (index < REGISTER_COUNT)) ? _registers[index] : 0;
+}
+
+quint32 VirtualBoard::getReadCount()
+{
+    return _readCount;
+}
+
+quint32 VirtualBoard::getWriteCount()
+{
+    return _writeCount;
+}
+
+bool VirtualBoard::readRegister(quint32 index, quint32 &value)
+{
+    if ((index >= COEFFICIENT_INDEX) && (index < COEFFICIENT_INDEX+COEFFICIENT_COUNT)) {
+        value = _coefficients[index-COEFFICIENT_INDEX];
+        return true;
+    }
+    if ((index >= BIQUAD_INDEX) && (index < BIQUAD_INDEX+BIQUAD_COUNT)) {
+        value = _biquadCoefficients[index-BIQUAD_INDEX];
+        return true;
+    }
+    if (index >= REGISTER_COUNT) {
+        return false;
+    }
+    value = _registers[index] & _masks[index];
+
+    // register_was_read resets the peak
+    if (isMeter(index)) {
+        _registers[index] = 0xff;
+    }
+    return true;
+}
+
+bool VirtualBoard::writeRegister(quint32 index, quint32 value)
+{
+    // the coefficient ram is 24 bits wide
+    if ((index >= COEFFICIENT_INDEX) && (index < COEFFICIENT_INDEX+COEFFICIENT_COUNT)) {
+        _coefficients[index-COEFFICIENT_INDEX] = value & 0x00ffffff;
+        return true;
+    }
+    // DATA_W of biquad.vhd
+    if ((index >= BIQUAD_INDEX) && (index < BIQUAD_INDEX+BIQUAD_COUNT)) {
+        _biquadCoefficients[index-BIQUAD_INDEX] = value & 0x07ffffff;
+        return true;
+    }
+    if ((index >= REGISTER_COUNT) || _readOnly[index]) {
+        return false;
+    }
+    _registers[index] = value & _masks[index];
+    return true;
+}
+
+bool VirtualBoard::isMeter(quint32 index)
+{
+    return (index == IN_METER_R) || (index == IN_METER_L) || (index == OUT_METER_R) || (index == OUT_METER_L);
+}
@@ -0,0 +1,77 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 17.10.2026
+// Filename  : virtualboard.h
+// Changelog : 17.10.2026 - file created
+//             17.10.2026 - fir coefficient banks
+//             17.10.2026 - biquad coefficient memory
+//------------------------------------------------------------------------------
+
+#ifndef VIRTUALBOARD_H
+#define VIRTUALBOARD_H
+
+#include <QtGlobal>
+#include <QRandomGenerator>
+
+// register bank and eth_ctrl command handling of one audio board
+//
+// the register map follows audio_top.vhd, meters hold their peak until
+// they are read like meter.vhd does. the fir coefficient banks are
+// modelled at the window used by CoefficientLoader, the biquad coefficient
+// memory at the one of BiquadUploader
+class VirtualBoard
+{
+
+public:
+    enum Result {
+        RESULT_NONE,        // write or invalid packet, nothing to send
+        RESULT_RESPONSE,    // read response in the output buffer
+        RESULT_TIMEOUT      // register bank did not acknowledge
+    };
+
+    VirtualBoard(quint32 seed);
+
+    Result   handlePacket(const char *packet, int size, char *response, int &responseSize);
+    int      makeTimeoutResponse(quint8 id, char *response);
+    void     updateSignal();
+    quint32  getRegister(int index);
+    quint32  getReadCount();
+    quint32  getWriteCount();
+
+    static const int REGISTER_COUNT   = 16;
+    static const int MAX_PACKET_SIZE  = 1500;
+    static const int COEFFICIENT_INDEX = 0x400;     // byte address 0x1000
+    static const int COEFFICIENT_COUNT = 4 * 512;   // two banks of left and right
+    static const int BIQUAD_INDEX      = 0x1000;    // byte address 0x4000
+    static const int BIQUAD_COUNT      = 512;       // up to 16 sections per channel
+
+private:
+    enum RegisterIndex {
+        VERSION       = 0,
+        IN_METER_R    = 1,
+        IN_METER_L    = 2,
+        IN_FADER_R    = 3,
+        IN_FADER_L    = 4,
+        OUT_METER_R   = 5,
+        OUT_METER_L   = 6,
+        CONV_FADER_R  = 7,
+        CONV_FADER_L  = 8
+    };
+
+    bool    readRegister(quint32 index, quint32 &value);
+    bool    writeRegister(quint32 index, quint32 value);
+    bool    isMeter(quint32 index);
+
+    quint32          _registers[REGISTER_COUNT];
+    quint32          _masks[REGISTER_COUNT];
+    bool             _readOnly[REGISTER_COUNT];
+    quint32          _coefficients[COEFFICIENT_COUNT];
+    quint32          _biquadCoefficients[BIQUAD_COUNT];
+    quint32          _signalR;
+    quint32          _signalL;
+    quint32          _readCount;
+    quint32          _writeCount;
+    QRandomGenerator _random;
+};
+
+#endif // VIRTUALBOARD_H
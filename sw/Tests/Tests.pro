@@ -0,0 +1,33 @@
+#-------------------------------------------------
+#
+# Tests of the Core library, run with make check
+# and without network access
+#
+#-------------------------------------------------
+
+QT       += core
+QT       += network
+QT       += testlib
+QT       -= gui
+
+TARGET = tst_updater
+TEMPLATE = app
+CONFIG += console
+CONFIG += testcase
+CONFIG -= app_bundle
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+CONFIG += c++11
+
+# the allocations are counted with the operator new of the benchmark
+include(../Core/core.pri)
+INCLUDEPATH += ../Benchmark
+VPATH += ../Benchmark
+
+SOURCES += \
+    tst_updater.cpp \
+    allocationcounter.cpp
+
+HEADERS += \
+    allocationcounter.h
@@ -0,0 +1,160 @@
+//------------------------------------------------------------------------------
+// Author    : Andreas Buerkler
+// Date      : 18.10.2026
+// Filename  : tst_updater.cpp
+// Changelog : 18.10.2026 - file created
+//             18.10.2026 - recall while writes are suspended
+//------------------------------------------------------------------------------
+
+#include <QtTest>
+#include "updater.h"
+#include "registermap.h"
+#include "typedefinitions.h"
+#include "allocationcounter.h"
+
+namespace {
+    // completes every request in place like a board that always answers,
+    // nothing is allocated
+    class LoopbackAccess : public IRegisterAccess
+    {
+
+    public:
+        LoopbackAccess()
+        {
+            for (int index=0; index<REGISTER_COUNT; index++) {
+                _registers[index] = 0;
+            }
+        }
+
+        int read(quint32 address, QVector<quint32> &data, int length) override
+        {
+            for (int word=0; word<length; word++) {
+                data.append(getRegister(address + static_cast<quint32>(word*REGISTER_SIZE)));
+            }
+            return AUDIO_SUCCESS;
+        }
+
+        int write(quint32 address, QVector<quint32> &data) override
+        {
+            return writeAsync(address, data, nullptr);
+        }
+
+        int readAsync(quint32 address, int length, ReadCallback callback) override
+        {
+            for (int word=0; word<length; word++) {
+                _readBuffer[word] = getRegister(address + static_cast<quint32>(word*REGISTER_SIZE));
+            }
+            if (callback) {
+                callback(AUDIO_SUCCESS, _readBuffer, length);
+            }
+            return AUDIO_SUCCESS;
+        }
+
+        int writeAsync(quint32 address, const QVector<quint32> &data, WriteCallback callback) override
+        {
+            for (int word=0; word<data.length(); word++) {
+                int index = static_cast<int>(address / REGISTER_SIZE) + word;
+                if (index < REGISTER_COUNT) {
+                    _registers[index] = data[word];
+                }
+            }
+            if (callback) {
+                callback(AUDIO_SUCCESS);
+            }
+            return AUDIO_SUCCESS;
+        }
+
+        void poll(int) override {}
+
+        quint32 getRegister(quint32 address)
+        {
+            int index = static_cast<int>(address / REGISTER_SIZE);
+            return (index < REGISTER_COUNT) ? _registers[index] : 0;
+        }
+
+    private:
+        quint32 _registers[REGISTER_COUNT];
+        quint32 _readBuffer[MAX_TRANSFER_WORDS];
+    };
+
+    // a fader that moves on every tick, or a meter that takes the readings
+    class MovingElement : public IUpdateElement
+    {
+
+    public:
+        MovingElement() : _value(0) {}
+
+        void updateParam(unsigned int *param) override
+        {
+            _value++;
+            *param = _value;
+        }
+
+    private:
+        unsigned int _value;
+    };
+}
+
+class TestUpdater : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void tickDoesNotAllocate();
+    void recallWaitsForWrites();
+};
+
+void TestUpdater::tickDoesNotAllocate()
+{
+    LoopbackAccess access;
+    Updater updater(&access, nullptr);
+    updater.setInterval(0);
+
+    MovingElement elements[8];
+    updater.addElement(RegisterMap::InMeterR::address(), &elements[0], true);
+    updater.addElement(RegisterMap::InMeterL::address(), &elements[1], true);
+    updater.addElement(RegisterMap::OutMeterR::address(), &elements[2], true);
+    updater.addElement(RegisterMap::OutMeterL::address(), &elements[3], true);
+    updater.addElement(RegisterMap::InFaderR::address(), &elements[4], false);
+    updater.addElement(RegisterMap::InFaderL::address(), &elements[5], false);
+    updater.addElement(RegisterMap::ConvFaderR::address(), &elements[6], false);
+    updater.addElement(RegisterMap::ConvFaderL::address(), &elements[7], false);
+
+    // the first ticks plan the bursts and grow the buffers
+    for (int tick=0; tick<10; tick++) {
+        updater.update();
+    }
+
+    quint64 allocations = AllocationCounter::getAllocations();
+    for (int tick=0; tick<1000; tick++) {
+        updater.update();
+    }
+    allocations = AllocationCounter::getAllocations() - allocations;
+
+    QCOMPARE(allocations, static_cast<quint64>(0));
+}
+
+void TestUpdater::recallWaitsForWrites()
+{
+    LoopbackAccess access;
+    Updater updater(&access, nullptr);
+    quint32 address = RegisterMap::InFaderR::address();
+
+    Scene first;
+    first.setValue(address, 10);
+    Scene second;
+    second.setValue(address, 20);
+
+    // nothing reaches the board while suspended, the last recall wins
+    updater.setWritesSuspended(true);
+    updater.recallScene(first);
+    updater.recallScene(second);
+    QCOMPARE(access.getRegister(address), static_cast<quint32>(0));
+
+    updater.setWritesSuspended(false);
+    QCOMPARE(access.getRegister(address), static_cast<quint32>(20));
+}
+
+QTEST_GUILESS_MAIN(TestUpdater)
+
+#include "tst_updater.moc"
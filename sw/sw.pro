@@ -0,0 +1,24 @@
+#-------------------------------------------------
+#
+# All applications of the control software, the
+# Core library is built first, the Tests run with
+# make check
+#
+#-------------------------------------------------
+
+TEMPLATE = subdirs
+
+SUBDIRS += \
+    Core \
+    Audio \
+    Control \
+    Simulator \
+    Renderer \
+    Benchmark \
+    Tests
+
+Audio.depends = Core
+Control.depends = Core
+Renderer.depends = Core
+Benchmark.depends = Core
+Tests.depends = Core